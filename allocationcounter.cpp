@@ -0,0 +1,140 @@
+#include "allocationcounter.h"
+
+#ifdef ALLOCATION_COUNTER
+#include <QAtomicInteger>
+#include <errno.h>
+#include <new>
+#include <stdlib.h>
+
+// 정적 초기화 전(다른 전역 객체 생성자)에도 불릴 수 있으므로 상수 초기화되는 값만 씀
+static QAtomicInteger<quint64> totalAllocations(0);
+static thread_local quint64 threadAllocations = 0;
+
+static inline void countAllocation()
+{
+    totalAllocations.fetchAndAddRelaxed(1);
+    ++threadAllocations;
+}
+
+#if defined(__GLIBC__)
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void *__libc_memalign(size_t alignment, size_t size);
+extern "C" void *__libc_valloc(size_t size);
+extern "C" void *__libc_pvalloc(size_t size);
+
+// operator new도 결국 아래 함수를 부르므로 여기서 한 번만 셈
+extern "C" void *malloc(size_t size)
+{
+    countAllocation();
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    countAllocation();
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    countAllocation();
+    return __libc_realloc(ptr, size);
+}
+
+// 정렬 할당 (정렬 operator new는 aligned_alloc/posix_memalign을 거침)
+// glibc는 posix_memalign/aligned_alloc의 __libc_ 버전을 내보내지 않으므로 memalign으로 구현
+extern "C" void *memalign(size_t alignment, size_t size)
+{
+    countAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+    if (alignment == 0 || alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+    countAllocation();
+    void *p = __libc_memalign(alignment, size);
+    if (!p)
+        return ENOMEM;
+    *ptr = p;
+    return 0;
+}
+
+extern "C" void *aligned_alloc(size_t alignment, size_t size)
+{
+    countAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" void *valloc(size_t size)
+{
+    countAllocation();
+    return __libc_valloc(size);
+}
+
+extern "C" void *pvalloc(size_t size)
+{
+    countAllocation();
+    return __libc_pvalloc(size);
+}
+#else
+void *operator new(size_t size)
+{
+    countAllocation();
+    if (void *p = malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+#endif
+
+bool AllocationCounter::isEnabled()
+{
+    return true;
+}
+
+quint64 AllocationCounter::count()
+{
+    return totalAllocations.loadAcquire();
+}
+
+quint64 AllocationCounter::threadCount()
+{
+    return threadAllocations;
+}
+
+#else
+
+bool AllocationCounter::isEnabled()
+{
+    return false;
+}
+
+quint64 AllocationCounter::count()
+{
+    return 0;
+}
+
+quint64 AllocationCounter::threadCount()
+{
+    return 0;
+}
+
+#endif
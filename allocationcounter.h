@@ -0,0 +1,21 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <QtGlobal>
+
+// 힙 할당 횟수 계측 (디버그 빌드 전용, ALLOCATION_COUNTER 정의 시에만 가로챔)
+// glibc: malloc, calloc, realloc, memalign, posix_memalign, aligned_alloc, valloc, pvalloc를 가로챔
+//        operator new(정렬 버전 포함)와 Qt의 QVector/QString 데이터는 모두 이 함수들을 거치므로 함께 셈
+//        (mmap 직접 호출, 다른 라이브러리가 정적으로 링크한 자체 할당기는 세지 못함)
+// 그 밖의 C 라이브러리: 전역 operator new/new[]만 바꿔 끼움 (malloc 직접 호출과 정렬 operator new는 세지 못함)
+// 스레드별 카운터가 따로 있어 오디오 스레드 할당과 섞이지 않고 게임 루프 구간만 잴 수 있음
+// 릴리스 빌드에서는 가로채지 않고 모든 값이 0
+class AllocationCounter
+{
+public:
+    static bool isEnabled();
+    static quint64 count();         // 모든 스레드 합계
+    static quint64 threadCount();   // 호출한 스레드에서 일어난 할당만
+};
+
+#endif // ALLOCATIONCOUNTER_H
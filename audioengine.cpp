@@ -0,0 +1,719 @@
+#include "audioengine.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QTextStream>
+#include <QTimer>
+#include <QDebug>
+#include <QtConcurrent/QtConcurrentRun>
+#include <alsa/asoundlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+// 모노토닉 시계 (ns) - 지연 측정용
+static inline qint64 monotonicNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return qint64(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+// 스레드 CPU 시간 (ns) - 믹서 부하 측정용
+static inline qint64 threadCpuNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return qint64(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+// 지연 히스토그램 구간 라벨 (ms)
+static const char *latencyBucketLabels[AudioStats::LATENCY_BUCKETS] = {
+    "<1", "1-2", "2-4", "4-8", "8-16", "16-32", "32-64", "64-128", "128-256", ">=256"
+};
+
+AudioEngine *AudioEngine::instance()
+{
+    static AudioEngine *engine = nullptr;
+    if (!engine) {
+        engine = new AudioEngine();
+        engine->start(QThread::TimeCriticalPriority);
+    }
+    return engine;
+}
+
+AudioEngine::AudioEngine(QObject *parent)
+    : QThread(parent)
+    , commandHead(0)
+    , commandTail(0)
+    , retiredHead(0)
+    , retiredTail(0)
+    , stopRequested(0)
+    , sampleRate(44100)
+    , periodFrames(512)
+    , periodCount(3)
+    , deviceName("plughw:0,0")
+    , duplex(qEnvironmentVariable("AUDIO_DUPLEX", "1") != "0")
+    , echoRef(nullptr)
+    , echoWritePos(0)
+    , echoAccum(0)
+    , echoAccumCount(0)
+    , echoPhase(0)
+{
+    // 보드마다 주기 크기를 조정할 수 있도록 환경 변수로 설정
+    bool ok = false;
+    int value = qEnvironmentVariableIntValue("AUDIO_RATE", &ok);
+    if (ok && value > 0) sampleRate = value;
+    value = qEnvironmentVariableIntValue("AUDIO_PERIOD_FRAMES", &ok);
+    if (ok && value > 0) periodFrames = value;
+    value = qEnvironmentVariableIntValue("AUDIO_PERIODS", &ok);
+    if (ok && value > 1) periodCount = value;
+    if (qEnvironmentVariableIsSet("AUDIO_DEVICE"))
+        deviceName = qEnvironmentVariable("AUDIO_DEVICE");
+
+    memset(voices, 0, sizeof(voices));
+    wt_init_table();
+    wt_osc_init(&referenceTone, sampleRate);
+    // 스레드 시작 전에 공개, 장치가 다른 값을 허용하면 run()에서 다시 공개
+    deviceRate.storeRelease(sampleRate);
+    devicePeriodFrames.storeRelease(periodFrames);
+}
+
+AudioEngine::~AudioEngine()
+{
+    shutdown();
+    // 장치가 멈춰 writei에서 돌아오지 않아도 종료가 막히지 않도록 제한 시간 뒤 강제 종료
+    if (!waitForShutdown()) {
+        qDebug() << "AudioEngine: audio thread did not stop in time, terminating";
+        terminate();
+        wait();
+    }
+    for (int v = 0; v < MAX_VOICES; ++v)
+        delete voices[v].stream;
+    reapRetired();
+    for (QFutureWatcher<AudioClip *> *watcher : qAsConst(clipLoads)) {
+        watcher->disconnect(this);
+        watcher->waitForFinished();
+        delete watcher->result();
+    }
+    qDeleteAll(clipCache);
+    qDeleteAll(staleClips);
+}
+
+// 작업 스레드: 효과음은 짧으므로 엔진 포맷(스테레오 16bit, rate)으로 전부 디코딩
+AudioClip *AudioEngine::decodeClip(const QString &file, int rate)
+{
+    AudioStream stream;
+    if (!stream.open(file, rate))
+        return nullptr;
+
+    AudioClip *clip = new AudioClip;
+    clip->rate = rate;
+    clip->samples.resize(stream.estimatedFrames() * 2);
+    clip->frames = stream.read(clip->samples.data(), stream.estimatedFrames(), false);
+    if (clip->frames <= 0) {
+        delete clip;
+        return nullptr;
+    }
+    clip->samples.resize(clip->frames * 2);
+
+    qDebug() << "AudioEngine: loaded" << file << clip->frames << "frames at" << rate << "Hz";
+    return clip;
+}
+
+// 캐시에 있으면 바로 반환, 없으면 작업 스레드 디코딩을 시작하고 nullptr (GUI 스레드는 파일 I/O를 기다리지 않음)
+// 장치가 디코딩 때와 다른 샘플레이트로 열렸으면 다시 디코딩
+const AudioClip *AudioEngine::loadClip(const QString &file)
+{
+    const auto it = clipCache.constFind(file);
+    if (it != clipCache.constEnd() && (!it.value() || it.value()->rate == outputRate()))
+        return it.value();
+    startClipLoad(file);
+    return nullptr;
+}
+
+void AudioEngine::startClipLoad(const QString &file)
+{
+    if (clipLoads.contains(file)) return;
+
+    auto *watcher = new QFutureWatcher<AudioClip *>(this);
+    clipLoads.insert(file, watcher);
+    connect(watcher, &QFutureWatcher<AudioClip *>::finished, this, [this, file, watcher]() {
+        clipLoads.remove(file);
+        watcher->deleteLater();
+        AudioClip *clip = watcher->result();
+        if (clip && clip->rate != outputRate()) {
+            // 디코딩 중에 장치가 다른 샘플레이트로 열림
+            delete clip;
+            startClipLoad(file);
+            return;
+        }
+        if (AudioClip *old = clipCache.value(file))
+            staleClips.append(old);
+        clipCache.insert(file, clip);
+        if (pendingSounds.remove(file) && clip)
+            enqueue(CmdPlaySound, clip);
+    });
+    watcher->setFuture(QtConcurrent::run(&AudioEngine::decodeClip, file, outputRate()));
+}
+
+// GUI 스레드: 명령 링에 추가 (가득 차면 버림, 오디오 스레드를 기다리지 않음)
+bool AudioEngine::enqueue(CommandType type, const AudioClip *clip, AudioStream *stream,
+                          double toneHz, qint32 gain, int rampFrames)
+{
+    reapRetired();
+
+    const quint32 head = commandHead.loadAcquire();
+    if (head - commandTail.loadAcquire() >= COMMAND_RING_SIZE) {
+        qDebug() << "AudioEngine: command queue full, dropping command";
+        delete stream;
+        return false;
+    }
+    Command &cmd = commandRing[head & (COMMAND_RING_SIZE - 1)];
+    cmd.type = type;
+    cmd.clip = clip;
+    cmd.stream = stream;
+    cmd.toneHz = toneHz;
+    cmd.gain = gain;
+    cmd.rampFrames = rampFrames;
+    cmd.enqueueNs = monotonicNs();
+    commandHead.storeRelease(head + 1);
+    return true;
+}
+
+// GUI 스레드: 오디오 스레드가 반환한 스트림 해제
+void AudioEngine::reapRetired()
+{
+    quint32 tail = retiredTail.loadAcquire();
+    const quint32 head = retiredHead.loadAcquire();
+    while (tail != head) {
+        delete retiredRing[tail & (RETIRED_RING_SIZE - 1)];
+        ++tail;
+    }
+    retiredTail.storeRelease(tail);
+}
+
+void AudioEngine::playSound(const QString &file)
+{
+    const AudioClip *clip = loadClip(file);
+    if (clip)
+        enqueue(CmdPlaySound, clip);
+    else if (clipLoads.contains(file))
+        pendingSounds.insert(file);
+}
+
+void AudioEngine::preloadSounds(const QStringList &files)
+{
+    for (const QString &file : files)
+        loadClip(file);
+}
+
+// 배경 음악은 헤더만 읽고 오디오 스레드에서 블록 단위로 스트리밍 디코딩 (PCM / IMA ADPCM)
+void AudioEngine::playMusic(const QString &file)
+{
+    AudioStream *stream = new AudioStream;
+    if (!stream->open(file, outputRate())) {
+        delete stream;
+        return;
+    }
+    musicCompressed.storeRelease(stream->isCompressed() ? 1 : 0);
+    musicBufferBytes.storeRelease(stream->bufferBytes());
+    enqueue(CmdPlayMusic, nullptr, stream);
+}
+
+void AudioEngine::stopMusic(int fadeMs)
+{
+    enqueue(CmdStopMusic, nullptr, nullptr, 0.0, 0, qMax(1, outputRate() * fadeMs / 1000));
+}
+
+void AudioEngine::fadeMusic(int volumePercent, int durationMs)
+{
+    const qint32 gain = qint32(qint64(GAIN_UNITY) * qBound(0, volumePercent, 100) / 100);
+    enqueue(CmdFadeMusic, nullptr, nullptr, 0.0, gain, qMax(1, outputRate() * durationMs / 1000));
+}
+
+// 다가오는 장애물 틈에 해당하는 음을 웨이브테이블 오실레이터로 합성
+void AudioEngine::setReferenceNote(int pitchScore)
+{
+    enqueue(CmdToneNote, nullptr, nullptr, wt_score_to_hz(qBound(1, pitchScore, 37)));
+}
+
+void AudioEngine::stopReferenceTone()
+{
+    enqueue(CmdToneOff);
+}
+
+// 종료 명령만 넣고 바로 반환 - 오디오 스레드는 진행 중인 주기를 쓰고 장치 버퍼를 버린 뒤 장치를 닫음
+void AudioEngine::shutdown()
+{
+    stopCapture();
+    if (!isRunning()) return;
+    // 큐가 가득 차 있어도 종료는 보장되도록 플래그를 직접 설정
+    if (!enqueue(CmdShutdown))
+        stopRequested.storeRelease(1);
+}
+
+bool AudioEngine::waitForShutdown()
+{
+    // 이벤트 루프가 끝난 뒤에는 지연 kill 타이머가 돌지 않으므로 남은 캡처 프로세스는 즉시 종료
+    for (QProcess *process : findChildren<QProcess *>()) {
+        if (process->state() != QProcess::NotRunning)
+            process->kill();
+    }
+    if (!isRunning()) return true;
+    // 오디오 스레드는 쓰는 중인 주기(writei는 한 주기 분량의 공간이 날 때까지만 대기)를 마치면 바로 종료
+    const ulong rate = ulong(qMax(1, outputRate()));
+    const ulong periodMs = (ulong(devicePeriodFrames.loadAcquire()) * 1000 + rate - 1) / rate;
+    return wait(periodMs + 1);
+}
+
+// 게임 중 마이크 피치 검출 프로세스 시작 (시작 완료를 기다리지 않음)
+void AudioEngine::startCapture()
+{
+    stopCapture();
+
+    QProcess *process = new QProcess(this);
+    const QString workingDir = QCoreApplication::applicationDirPath();
+    process->setWorkingDirectory(workingDir);
+    qDebug() << "Starting mic process in directory:" << workingDir;
+
+    connect(process, &QProcess::started, this, []() {
+        qDebug() << "Mic process started successfully";
+    });
+    connect(process, &QProcess::errorOccurred, this, [process](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart) return;
+        // 마이크가 없어도 게임이 실행되도록 기본값 생성
+        qDebug() << "Mic not available, game will run with default values";
+        QFile defaultFile("/tmp/pitch_score");
+        if (defaultFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            QTextStream stream(&defaultFile);
+            stream << "15 500.0\n";  // 중간 높이와 적절한 볼륨으로 설정
+            defaultFile.close();
+        }
+        process->deleteLater();
+    });
+
+    // 듀플렉스 모드면 게임 출력 신호를 에코 참조로 사용하도록 -d 전달
+    QStringList micArgs;
+    if (duplex)
+        micArgs << "-d";
+    process->start("./mic", micArgs, QIODevice::ReadWrite);
+    captureProcess = process;
+}
+
+// terminate만 보내고 반환, 프로세스 객체는 종료 시그널에서 해제
+void AudioEngine::stopCapture()
+{
+    if (!captureProcess) return;
+    QProcess *process = captureProcess;
+    captureProcess = nullptr;
+    process->disconnect(this);
+
+    if (process->state() == QProcess::NotRunning) {
+        process->deleteLater();
+        return;
+    }
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            process, &QObject::deleteLater);
+    process->terminate();
+    QTimer::singleShot(CAPTURE_KILL_TIMEOUT_MS, process, [process]() {
+        if (process->state() != QProcess::NotRunning) {
+            qDebug() << "Mic process ignored SIGTERM, killing";
+            process->kill();
+        }
+    });
+}
+
+// 오디오 스레드: 다 쓴 스트림을 GUI 스레드로 넘김
+void AudioEngine::retireStream(AudioStream *stream)
+{
+    if (!stream) return;
+    const quint32 head = retiredHead.loadAcquire();
+    if (head - retiredTail.loadAcquire() >= RETIRED_RING_SIZE) {
+        delete stream; // 정상 동작에서는 도달하지 않음
+        return;
+    }
+    retiredRing[head & (RETIRED_RING_SIZE - 1)] = stream;
+    retiredHead.storeRelease(head + 1);
+}
+
+// 오디오 스레드: 대기 중인 명령을 보이스에 반영 (잠금 없음)
+void AudioEngine::drainCommands()
+{
+    quint32 tail = commandTail.loadAcquire();
+    const quint32 head = commandHead.loadAcquire();
+    for (; tail != head; ++tail) {
+        const Command &cmd = commandRing[tail & (COMMAND_RING_SIZE - 1)];
+        if (cmd.type == CmdShutdown) {
+            stopRequested.storeRelease(1);
+            continue;
+        }
+        if (cmd.type == CmdToneNote) {
+            // 위상은 유지한 채 주파수만 바꿔 클릭 없이 음 전환, 진폭은 10ms 동안 올림
+            wt_osc_set_freq(&referenceTone, cmd.toneHz, sampleRate);
+            wt_osc_set_gain(&referenceTone, REFERENCE_TONE_GAIN, sampleRate / 100);
+            continue;
+        }
+        if (cmd.type == CmdToneOff) {
+            wt_osc_set_gain(&referenceTone, 0, sampleRate / 100);
+            continue;
+        }
+        if (cmd.type == CmdStopMusic || cmd.type == CmdFadeMusic) {
+            Voice &music = voices[0];
+            if (!music.stream) continue;
+            music.gainTarget = cmd.gain;
+            music.rampFrames = cmd.rampFrames;
+            music.gainStep = (music.gainTarget - music.gain) / cmd.rampFrames;
+            music.stopAfterFade = (cmd.type == CmdStopMusic);
+            continue;
+        }
+
+        // GUI 스레드가 장치 샘플레이트를 알기 전에 준비한 데이터: 효과음은 버리고(새 클립이 다시 디코딩됨),
+        // 스트림은 리샘플 간격만 고침
+        if (cmd.type == CmdPlaySound && cmd.clip->rate != sampleRate)
+            continue;
+        if (cmd.type == CmdPlayMusic && cmd.stream->rate() != sampleRate)
+            cmd.stream->setOutputRate(sampleRate);
+
+        int slot = -1;
+        if (cmd.type == CmdPlayMusic) {
+            slot = 0;
+        } else {
+            // 빈 슬롯이 없으면 가장 많이 재생된 효과음을 대체
+            int bestPos = -1;
+            for (int v = 1; v < MAX_VOICES; ++v) {
+                if (!voices[v].clip) { slot = v; break; }
+                if (voices[v].pos > bestPos) { bestPos = voices[v].pos; slot = v; }
+            }
+        }
+        Voice &voice = voices[slot];
+        if (voice.stream != cmd.stream)
+            retireStream(voice.stream);
+        voice.clip = cmd.clip;
+        voice.stream = cmd.stream;
+        voice.pos = 0;
+        voice.loop = (cmd.type == CmdPlayMusic);
+        voice.pendingLatency = true;
+        voice.enqueueNs = cmd.enqueueNs;
+        voice.gain = GAIN_UNITY;
+        voice.gainTarget = GAIN_UNITY;
+        voice.gainStep = 0;
+        voice.rampFrames = 0;
+        voice.stopAfterFade = false;
+    }
+    commandTail.storeRelease(tail);
+}
+
+// 오디오 스레드: 스트리밍 보이스를 이번 주기 분량만 디코딩하여 누산 (버퍼는 미리 할당됨)
+void AudioEngine::mixStream(Voice &voice, qint32 *acc, int frames)
+{
+    qint16 *s = streamBuffer.data();
+    const int n = voice.stream->read(s, frames, voice.loop);
+    if (voice.gain == GAIN_UNITY && voice.rampFrames == 0) {
+        for (int i = 0; i < n * 2; ++i)
+            acc[i] += s[i];
+    } else {
+        for (int i = 0; i < n; ++i) {
+            if (voice.rampFrames > 0) {
+                voice.gain += voice.gainStep;
+                if (--voice.rampFrames == 0)
+                    voice.gain = voice.gainTarget;
+            }
+            acc[i * 2] += (s[i * 2] * voice.gain) >> 16;
+            acc[i * 2 + 1] += (s[i * 2 + 1] * voice.gain) >> 16;
+        }
+    }
+    // 덜 채웠으면 스트림 끝 (반복 재생이면 읽기/되감기 실패) - 이후 read()는 계속 0이라 페이드도 끝나지 않으므로 바로 해제
+    if (n < frames || (voice.stopAfterFade && voice.rampFrames == 0)) {
+        retireStream(voice.stream);
+        voice.stream = nullptr;
+    }
+}
+
+// 활성 보이스를 한 주기만큼 믹싱하고 활성 보이스 수를 반환
+int AudioEngine::mixPeriod(qint16 *out, int frames)
+{
+    qint32 *acc = mixBuffer.data();
+    memset(acc, 0, sizeof(qint32) * frames * 2);
+
+    int active = 0;
+    for (int v = 0; v < MAX_VOICES; ++v) {
+        Voice &voice = voices[v];
+        if (voice.stream) {
+            ++active;
+            mixStream(voice, acc, frames);
+            continue;
+        }
+        if (!voice.clip) continue;
+        ++active;
+
+        const qint16 *src = voice.clip->samples.constData();
+        int written = 0;
+        while (written < frames) {
+            const int n = qMin(frames - written, voice.clip->frames - voice.pos);
+            const qint16 *s = src + voice.pos * 2;
+            qint32 *d = acc + written * 2;
+            for (int i = 0; i < n * 2; ++i)
+                d[i] += s[i];
+            written += n;
+            voice.pos += n;
+            if (voice.pos >= voice.clip->frames) {
+                if (!voice.loop) { voice.clip = nullptr; break; }
+                voice.pos = 0;
+            }
+        }
+    }
+
+    // 기준음 (할당 없는 웨이브테이블 렌더링)
+    if (!wt_osc_is_silent(&referenceTone)) {
+        wt_osc_render_add(&referenceTone, acc, frames);
+        ++active;
+    }
+
+    for (int i = 0; i < frames * 2; ++i)
+        out[i] = qint16(qBound(-32768, acc[i], 32767));
+    return active;
+}
+
+// enqueue 시각부터 이번 주기의 첫 샘플이 DAC에 도달하는 시각까지의 지연 기록
+void AudioEngine::recordLatency(qint64 nowNs, long delayFrames)
+{
+    const qint64 dmaNs = nowNs + qint64(delayFrames) * 1000000000LL / sampleRate;
+    for (int v = 0; v < MAX_VOICES; ++v) {
+        Voice &voice = voices[v];
+        if (!voice.pendingLatency) continue;
+        voice.pendingLatency = false;
+
+        const qint64 us = qMax<qint64>(0, (dmaNs - voice.enqueueNs) / 1000);
+        int bucket = 0;
+        for (qint64 ms = us / 1000; ms > 0 && bucket < AudioStats::LATENCY_BUCKETS - 1; ms >>= 1)
+            ++bucket;
+        latencyHistogram[bucket].fetchAndAddRelaxed(1);
+        latencyCount.fetchAndAddRelaxed(1);
+        latencySumUs.fetchAndAddRelaxed(us);
+        lastLatencyUs.storeRelease(us);
+        if (us > maxLatencyUs.loadAcquire())
+            maxLatencyUs.storeRelease(us);
+    }
+}
+
+// 에코 참조용 공유 메모리 생성 (mic 프로세스가 읽기 전용으로 매핑)
+void AudioEngine::openEchoReference()
+{
+    int fd = shm_open(ECHOREF_SHM_NAME, O_CREAT | O_RDWR, 0666);
+    if (fd < 0) {
+        qDebug() << "AudioEngine: cannot create echo reference" << strerror(errno);
+        return;
+    }
+    if (ftruncate(fd, sizeof(echoref_t)) < 0) {
+        qDebug() << "AudioEngine: cannot size echo reference" << strerror(errno);
+        ::close(fd);
+        return;
+    }
+    void *mem = mmap(nullptr, sizeof(echoref_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        qDebug() << "AudioEngine: cannot map echo reference" << strerror(errno);
+        return;
+    }
+
+    echoRef = static_cast<echoref_t *>(mem);
+    memset(echoRef, 0, sizeof(echoref_t));
+    echoRef->magic = ECHOREF_MAGIC;
+    echoRef->rate = ECHOREF_RATE;
+    echoWritePos = 0;
+    echoAccum = 0;
+    echoAccumCount = 0;
+    echoPhase = 0;
+    qDebug() << "AudioEngine: duplex echo reference published at" << ECHOREF_SHM_NAME;
+}
+
+void AudioEngine::closeEchoReference()
+{
+    if (!echoRef) return;
+    echoRef->magic = 0;
+    munmap(echoRef, sizeof(echoref_t));
+    shm_unlink(ECHOREF_SHM_NAME);
+    echoRef = nullptr;
+}
+
+// 이번 주기 출력을 16kHz 모노로 줄여 기록 (구간 평균 = 간단한 저역 통과)
+void AudioEngine::publishEchoReference(const qint16 *out, int frames, qint64 dacTimeNs)
+{
+    const quint64 anchorPos = echoWritePos;
+    for (int i = 0; i < frames; ++i) {
+        echoAccum += (out[i * 2] + out[i * 2 + 1]) / 2;
+        ++echoAccumCount;
+        echoPhase += ECHOREF_RATE;
+        if (echoPhase >= sampleRate) {
+            echoPhase -= sampleRate;
+            echoRef->samples[echoWritePos & (ECHOREF_FRAMES - 1)] = qint16(echoAccum / echoAccumCount);
+            ++echoWritePos;
+            echoAccum = 0;
+            echoAccumCount = 0;
+        }
+    }
+    echoref_publish(echoRef, echoWritePos, anchorPos, dacTimeNs);
+}
+
+void AudioEngine::run()
+{
+    snd_pcm_t *pcm = nullptr;
+    int err = snd_pcm_open(&pcm, deviceName.toLocal8Bit().constData(), SND_PCM_STREAM_PLAYBACK, 0);
+    if (err < 0) {
+        qDebug() << "AudioEngine: cannot open" << deviceName << snd_strerror(err);
+        return;
+    }
+
+    snd_pcm_hw_params_t *params;
+    snd_pcm_hw_params_alloca(&params);
+    snd_pcm_hw_params_any(pcm, params);
+    snd_pcm_hw_params_set_access(pcm, params, SND_PCM_ACCESS_RW_INTERLEAVED);
+    snd_pcm_hw_params_set_format(pcm, params, SND_PCM_FORMAT_S16_LE);
+    snd_pcm_hw_params_set_channels(pcm, params, 2);
+    unsigned int rate = unsigned(sampleRate);
+    snd_pcm_hw_params_set_rate_near(pcm, params, &rate, nullptr);
+    snd_pcm_uframes_t period = snd_pcm_uframes_t(periodFrames);
+    snd_pcm_hw_params_set_period_size_near(pcm, params, &period, nullptr);
+    snd_pcm_uframes_t buffer = period * periodCount;
+    snd_pcm_hw_params_set_buffer_size_near(pcm, params, &buffer);
+    if ((err = snd_pcm_hw_params(pcm, params)) < 0) {
+        qDebug() << "AudioEngine: cannot set hw params" << snd_strerror(err);
+        snd_pcm_close(pcm);
+        return;
+    }
+
+    // 장치가 실제로 허용한 값으로 갱신 (이후 계측값의 기준)
+    sampleRate = int(rate);
+    periodFrames = int(period);
+    bufferFrames.storeRelease(int(buffer));
+    deviceRate.storeRelease(sampleRate);
+    devicePeriodFrames.storeRelease(periodFrames);
+    qDebug() << "AudioEngine: opened" << deviceName << sampleRate << "Hz, period" << periodFrames << "buffer" << int(buffer);
+
+    mixBuffer.resize(periodFrames * 2);
+    streamBuffer.resize(periodFrames * 2);
+    QVector<qint16> out(periodFrames * 2);
+    if (duplex)
+        openEchoReference();
+    running.storeRelease(1);
+
+    while (!stopRequested.loadAcquire()) {
+        drainCommands();
+        if (stopRequested.loadAcquire())
+            break;
+
+        const qint64 cpuStart = threadCpuNs();
+        const int active = mixPeriod(out.data(), periodFrames);
+        const qint64 mixNs = threadCpuNs() - cpuStart;
+
+        lastMixNs.storeRelease(mixNs);
+        mixSumNs.fetchAndAddRelaxed(mixNs);
+        if (mixNs > maxMixNs.loadAcquire())
+            maxMixNs.storeRelease(mixNs);
+        activeVoiceCount.storeRelease(active);
+        if (active > peakVoiceCount.loadAcquire())
+            peakVoiceCount.storeRelease(active);
+
+        snd_pcm_sframes_t delay = 0;
+        if (snd_pcm_delay(pcm, &delay) < 0)
+            delay = 0;
+        const qint64 nowNs = monotonicNs();
+        recordLatency(nowNs, long(delay));
+        if (echoRef)
+            publishEchoReference(out.constData(), periodFrames, nowNs + qint64(delay) * 1000000000LL / sampleRate);
+
+        const qint16 *ptr = out.constData();
+        int remaining = periodFrames;
+        while (remaining > 0 && !stopRequested.loadAcquire()) {
+            snd_pcm_sframes_t written = snd_pcm_writei(pcm, ptr, snd_pcm_uframes_t(remaining));
+            if (written == -EPIPE) {
+                xrunCount.fetchAndAddRelaxed(1);
+                snd_pcm_prepare(pcm);
+                continue;
+            } else if (written == -ESTRPIPE) {
+                suspendCount.fetchAndAddRelaxed(1);
+                while ((err = snd_pcm_resume(pcm)) == -EAGAIN)
+                    usleep(1000);
+                if (err < 0)
+                    snd_pcm_prepare(pcm);
+                continue;
+            } else if (written < 0) {
+                if (snd_pcm_recover(pcm, int(written), 1) < 0) {
+                    qDebug() << "AudioEngine: write failed" << snd_strerror(int(written));
+                    break;
+                }
+                continue;
+            }
+            ptr += written * 2;
+            remaining -= int(written);
+        }
+        periodsDone.fetchAndAddRelaxed(1);
+    }
+
+    running.storeRelease(0);
+    closeEchoReference();
+    snd_pcm_drop(pcm);
+    snd_pcm_close(pcm);
+    qDebug() << "AudioEngine: stopped";
+}
+
+AudioStats AudioEngine::stats() const
+{
+    AudioStats s;
+    s.running = running.loadAcquire() != 0;
+    s.sampleRate = deviceRate.loadAcquire();
+    s.periodFrames = devicePeriodFrames.loadAcquire();
+    s.bufferFrames = bufferFrames.loadAcquire();
+    s.periods = quint64(periodsDone.loadAcquire());
+    s.xruns = quint64(xrunCount.loadAcquire());
+    s.suspends = quint64(suspendCount.loadAcquire());
+    s.latencyCount = quint64(latencyCount.loadAcquire());
+    for (int i = 0; i < AudioStats::LATENCY_BUCKETS; ++i)
+        s.latencyHistogram[i] = quint64(latencyHistogram[i].loadAcquire());
+    s.lastLatencyMs = lastLatencyUs.loadAcquire() / 1000.0;
+    s.maxLatencyMs = maxLatencyUs.loadAcquire() / 1000.0;
+    s.avgLatencyMs = s.latencyCount ? latencySumUs.loadAcquire() / 1000.0 / s.latencyCount : 0.0;
+    s.lastMixUs = lastMixNs.loadAcquire() / 1000.0;
+    s.maxMixUs = maxMixNs.loadAcquire() / 1000.0;
+    s.avgMixUs = s.periods ? mixSumNs.loadAcquire() / 1000.0 / s.periods : 0.0;
+    s.periodUs = s.sampleRate > 0 ? s.periodFrames * 1000000.0 / s.sampleRate : 0.0;
+    s.activeVoices = activeVoiceCount.loadAcquire();
+    s.peakVoices = peakVoiceCount.loadAcquire();
+    s.musicCompressed = musicCompressed.loadAcquire() != 0;
+    s.musicBufferBytes = musicBufferBytes.loadAcquire();
+    return s;
+}
+
+// 디버그 오버레이와 로그에서 공통으로 사용하는 통계 문자열
+QStringList AudioEngine::statsLines() const
+{
+    const AudioStats s = stats();
+    QStringList lines;
+    if (!s.running) {
+        lines << "Audio: not running";
+        return lines;
+    }
+    lines << QString("Audio: %1Hz period %2 buffer %3").arg(s.sampleRate).arg(s.periodFrames).arg(s.bufferFrames);
+    lines << QString("Latency ms: last %1 avg %2 max %3")
+             .arg(s.lastLatencyMs, 0, 'f', 1).arg(s.avgLatencyMs, 0, 'f', 1).arg(s.maxLatencyMs, 0, 'f', 1);
+    QString histogram = "Hist:";
+    for (int i = 0; i < AudioStats::LATENCY_BUCKETS; ++i) {
+        if (s.latencyHistogram[i])
+            histogram += QString(" %1:%2").arg(latencyBucketLabels[i]).arg(s.latencyHistogram[i]);
+    }
+    lines << histogram;
+    lines << QString("XRUN: %1 suspend: %2").arg(s.xruns).arg(s.suspends);
+    lines << QString("Mix us: last %1 avg %2 max %3 / %4")
+             .arg(s.lastMixUs, 0, 'f', 0).arg(s.avgMixUs, 0, 'f', 0).arg(s.maxMixUs, 0, 'f', 0).arg(s.periodUs, 0, 'f', 0);
+    lines << QString("Voices: %1 (peak %2)").arg(s.activeVoices).arg(s.peakVoices);
+    lines << QString("Music: %1 stream buffer %2 B").arg(s.musicCompressed ? "ADPCM" : "PCM").arg(s.musicBufferBytes);
+    return lines;
+}
+
+void AudioEngine::dumpStats() const
+{
+    for (const QString &line : statsLines())
+        qDebug().noquote() << line;
+}
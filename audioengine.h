@@ -0,0 +1,194 @@
+#ifndef AUDIOENGINE_H
+#define AUDIOENGINE_H
+
+#include <QThread>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QPointer>
+#include <QProcess>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QAtomicInteger>
+#include "echoref.h"
+#include "audiostream.h"
+#include "wavetable.h"
+
+// 엔진 포맷으로 미리 변환된 효과음/음악 데이터 (인터리브 스테레오 16bit)
+struct AudioClip {
+    QVector<qint16> samples;
+    int frames;
+    int rate;               // 디코딩 기준 샘플레이트 (장치와 다르면 재생하지 않음)
+
+    AudioClip() : frames(0), rate(0) {}
+};
+
+// 출력 경로 계측값 스냅샷 (오버레이/로그 출력용)
+struct AudioStats {
+    static const int LATENCY_BUCKETS = 10; // <1, 1-2, 2-4, ... , >=256ms (log2 구간)
+
+    bool running;
+    int sampleRate;
+    int periodFrames;
+    int bufferFrames;
+    quint64 periods;
+    quint64 xruns;          // 언더런(-EPIPE) 횟수
+    quint64 suspends;       // 서스펜드(-ESTRPIPE) 횟수
+    quint64 latencyCount;
+    quint64 latencyHistogram[LATENCY_BUCKETS];
+    double lastLatencyMs;   // 마지막 enqueue → DMA 지연
+    double maxLatencyMs;
+    double avgLatencyMs;
+    double lastMixUs;       // 주기당 믹서 CPU 시간
+    double maxMixUs;
+    double avgMixUs;
+    double periodUs;        // 주기 길이 (믹서 예산)
+    int activeVoices;
+    int peakVoices;
+    bool musicCompressed;   // 배경 음악이 IMA ADPCM인지
+    int musicBufferBytes;   // 배경 음악 스트리밍 버퍼 크기 (곡 길이와 무관)
+};
+
+// ALSA 출력 스레드 + 소프트웨어 믹서
+// aplay 프로세스를 효과음마다 띄우는 대신 하나의 PCM 장치를 열어두고 직접 믹싱함
+// 모든 제어는 비동기 명령 큐로 전달되며 GUI 스레드는 어떤 호출에서도 대기하지 않음
+// 마이크 캡처 프로세스(mic)의 시작/종료도 이 서비스가 담당
+class AudioEngine : public QThread
+{
+    Q_OBJECT
+
+public:
+    static AudioEngine *instance();
+
+    void playSound(const QString &file);
+    void preloadSounds(const QStringList &files);     // 작업 스레드에서 미리 디코딩 (첫 재생 지연 방지)
+    void playMusic(const QString &file);
+    void stopMusic(int fadeMs = 20);                  // 짧은 페이드 후 정지 (클릭 방지)
+    void fadeMusic(int volumePercent, int durationMs); // 배경 음악 볼륨 페이드
+    void setReferenceNote(int pitchScore);  // 기준음 재생 (피치 점수 1~37)
+    void stopReferenceTone();
+    void shutdown();          // 대기하지 않음, 오디오 스레드는 한 주기 안에 종료 (장치 버퍼는 버림)
+    bool waitForShutdown();   // 앱 종료 직전에만 사용 (최대 한 주기 대기)
+    bool duplexEnabled() const { return duplex; }
+
+    // 마이크 캡처 프로세스 (종료는 terminate 후 완료 시그널로 정리, 응답 없으면 나중에 kill)
+    void startCapture();
+    void stopCapture();
+
+    AudioStats stats() const;
+    QStringList statsLines() const;
+    void dumpStats() const;
+
+protected:
+    void run() override;
+
+private:
+    explicit AudioEngine(QObject *parent = nullptr);
+    ~AudioEngine();
+
+    enum CommandType { CmdPlaySound, CmdPlayMusic, CmdStopMusic, CmdFadeMusic, CmdToneNote, CmdToneOff, CmdShutdown };
+    struct Command {
+        CommandType type;
+        const AudioClip *clip;
+        AudioStream *stream;
+        double toneHz;
+        qint32 gain;            // 페이드 목표 (Q16)
+        int rampFrames;         // 페이드 길이
+        qint64 enqueueNs;
+    };
+    struct Voice {
+        const AudioClip *clip;
+        AudioStream *stream;    // 배경 음악은 스트리밍 디코딩
+        int pos;
+        bool loop;
+        bool pendingLatency; // 첫 주기 믹싱 시 지연 측정 대상
+        qint64 enqueueNs;
+        qint32 gain;            // Q16, GAIN_UNITY면 곱셈 생략
+        qint32 gainTarget;
+        qint32 gainStep;
+        int rampFrames;
+        bool stopAfterFade;     // 페이드가 끝나면 보이스 해제
+    };
+
+    static AudioClip *decodeClip(const QString &file, int rate);
+    const AudioClip *loadClip(const QString &file);
+    void startClipLoad(const QString &file);
+    int outputRate() const { return deviceRate.loadAcquire(); }
+    bool enqueue(CommandType type, const AudioClip *clip = nullptr, AudioStream *stream = nullptr,
+                 double toneHz = 0.0, qint32 gain = 0, int rampFrames = 0);
+    void reapRetired();
+    void retireStream(AudioStream *stream);
+    void drainCommands();
+    void mixStream(Voice &voice, qint32 *acc, int frames);
+    int mixPeriod(qint16 *out, int frames);
+    void recordLatency(qint64 nowNs, long delayFrames);
+    void openEchoReference();
+    void closeEchoReference();
+    void publishEchoReference(const qint16 *out, int frames, qint64 dacTimeNs);
+
+    static const int MAX_VOICES = 8;        // 0번은 배경 음악 전용
+    static const quint32 COMMAND_RING_SIZE = 64;  // 2의 거듭제곱
+    static const quint32 RETIRED_RING_SIZE = 16;
+    static const qint32 GAIN_UNITY = 65536;
+    static const int REFERENCE_TONE_GAIN = 13107; // Q16, 약 0.2 (음악보다 작게)
+    static const int CAPTURE_KILL_TIMEOUT_MS = 3000;
+
+    QHash<QString, AudioClip *> clipCache;  // GUI 스레드 전용
+    QHash<QString, QFutureWatcher<AudioClip *> *> clipLoads;  // GUI 스레드 전용, 디코딩 중인 효과음
+    QSet<QString> pendingSounds;            // 디코딩이 끝나면 한 번 재생할 효과음
+    QVector<AudioClip *> staleClips;        // 샘플레이트가 바뀌어 교체된 클립 (오디오 스레드가 아직 재생 중일 수 있어 종료 시 해제)
+    QPointer<QProcess> captureProcess;      // GUI 스레드 전용
+
+    // GUI → 오디오 명령 링 (단일 생산자/단일 소비자, 잠금 없음)
+    // head는 GUI 스레드만, tail은 오디오 스레드만 증가시킴
+    Command commandRing[COMMAND_RING_SIZE];
+    QAtomicInteger<quint32> commandHead;
+    QAtomicInteger<quint32> commandTail;
+    // 오디오 → GUI 반환 링: 다 쓴 스트림 (GUI 스레드에서 해제하여 오디오 스레드는 free 하지 않음)
+    AudioStream *retiredRing[RETIRED_RING_SIZE];
+    QAtomicInteger<quint32> retiredHead;
+    QAtomicInteger<quint32> retiredTail;
+
+    Voice voices[MAX_VOICES];               // 오디오 스레드 전용
+    QVector<qint32> mixBuffer;
+    QVector<qint16> streamBuffer;
+    wt_osc_t referenceTone;                 // 오디오 스레드 전용
+
+    QAtomicInt stopRequested;
+    int sampleRate;                         // 시작 후에는 오디오 스레드 전용 (GUI 스레드는 deviceRate 사용)
+    int periodFrames;
+    int periodCount;
+    QString deviceName;
+
+    // 듀플렉스 모드: 출력 신호를 mic 프로세스에 에코 참조로 공유 (echoref.h)
+    bool duplex;
+    echoref_t *echoRef;
+    quint64 echoWritePos;
+    qint32 echoAccum;
+    int echoAccumCount;
+    int echoPhase;
+
+    // 계측 카운터 (오디오 스레드에서 갱신, GUI 스레드에서 읽기)
+    QAtomicInt running;
+    QAtomicInt deviceRate;                  // 시작 전에는 요청값, 장치를 연 뒤에는 협상된 값
+    QAtomicInt devicePeriodFrames;
+    QAtomicInteger<qint64> periodsDone;
+    QAtomicInteger<qint64> xrunCount;
+    QAtomicInteger<qint64> suspendCount;
+    QAtomicInteger<qint64> latencyHistogram[AudioStats::LATENCY_BUCKETS];
+    QAtomicInteger<qint64> latencyCount;
+    QAtomicInteger<qint64> latencySumUs;
+    QAtomicInteger<qint64> lastLatencyUs;
+    QAtomicInteger<qint64> maxLatencyUs;
+    QAtomicInteger<qint64> mixSumNs;
+    QAtomicInteger<qint64> lastMixNs;
+    QAtomicInteger<qint64> maxMixNs;
+    QAtomicInt activeVoiceCount;
+    QAtomicInt peakVoiceCount;
+    QAtomicInt bufferFrames;
+    QAtomicInt musicCompressed;
+    QAtomicInt musicBufferBytes;
+};
+
+#endif // AUDIOENGINE_H
@@ -0,0 +1,301 @@
+#include "audiostream.h"
+#include <QDebug>
+#include <string.h>
+
+static inline quint32 readLE32(const uchar *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (quint32(p[3]) << 24); }
+static inline quint16 readLE16(const uchar *p) { return quint16(p[0] | (p[1] << 8)); }
+
+// IMA ADPCM 표준 테이블
+static const int imaIndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const int imaStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static inline qint16 imaDecodeNibble(int nibble, int &predictor, int &index)
+{
+    const int stepSize = imaStepTable[index];
+    int diff = stepSize >> 3;
+    if (nibble & 1) diff += stepSize >> 2;
+    if (nibble & 2) diff += stepSize >> 1;
+    if (nibble & 4) diff += stepSize;
+    if (nibble & 8) diff = -diff;
+    predictor = qBound(-32768, predictor + diff, 32767);
+    index = qBound(0, index + imaIndexTable[nibble], 88);
+    return qint16(predictor);
+}
+
+AudioStream::AudioStream()
+    : format(0)
+    , channels(0)
+    , sourceRate(0)
+    , outputRate(0)
+    , blockAlign(0)
+    , samplesPerBlock(0)
+    , dataStart(0)
+    , dataSize(0)
+    , dataRead(0)
+    , sourceFrames(0)
+    , sourceIndex(0)
+    , step(0)
+    , frac(0)
+    , primed(false)
+    , finished(false)
+{
+    frameA[0] = frameA[1] = 0;
+    frameB[0] = frameB[1] = 0;
+}
+
+AudioStream::~AudioStream()
+{
+    close();
+}
+
+// 헤더를 읽어 포맷을 확인하고 블록 버퍼를 할당 (데이터는 읽지 않음)
+bool AudioStream::open(const QString &fileName, int rate)
+{
+    close();
+    file.setFileName(fileName);
+    // 버퍼 없이 열어 오디오 스레드의 read()가 블록 버퍼로 바로 읽음
+    // (QIODevice 버퍼는 오디오 스레드에서 버퍼 청크를 할당하고 한 번 더 복사함)
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+        qDebug() << "AudioStream: cannot open" << fileName;
+        return false;
+    }
+
+    uchar header[12];
+    if (file.read(reinterpret_cast<char *>(header), 12) != 12
+        || memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+        qDebug() << "AudioStream: not a RIFF/WAVE file" << fileName;
+        close();
+        return false;
+    }
+
+    int bits = 0;
+    bool haveFormat = false;
+    while (!file.atEnd()) {
+        uchar chunk[8];
+        if (file.read(reinterpret_cast<char *>(chunk), 8) != 8) break;
+        const quint32 chunkSize = readLE32(chunk + 4);
+        const qint64 bodyPos = file.pos();
+
+        if (memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16) {
+            uchar fmt[20];
+            memset(fmt, 0, sizeof(fmt));
+            file.read(reinterpret_cast<char *>(fmt), qMin<quint32>(chunkSize, sizeof(fmt)));
+            format = readLE16(fmt);
+            channels = readLE16(fmt + 2);
+            sourceRate = int(readLE32(fmt + 4));
+            blockAlign = readLE16(fmt + 12);
+            bits = readLE16(fmt + 14);
+            if (format == FORMAT_IMA_ADPCM && chunkSize >= 20)
+                samplesPerBlock = readLE16(fmt + 18);
+            haveFormat = true;
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            dataStart = bodyPos;
+            dataSize = qMin<qint64>(chunkSize, file.size() - bodyPos);
+            break;
+        }
+        file.seek(bodyPos + chunkSize + (chunkSize & 1));
+    }
+
+    const bool pcmOk = (format == FORMAT_PCM && bits == 16);
+    const bool imaOk = (format == FORMAT_IMA_ADPCM && bits == 4 && blockAlign > 4 * channels);
+    if (!haveFormat || dataStart == 0 || channels < 1 || channels > 2 || sourceRate <= 0 || rate <= 0 || !(pcmOk || imaOk)) {
+        qDebug() << "AudioStream: unsupported WAV format" << fileName << format << bits << channels << sourceRate;
+        close();
+        return false;
+    }
+
+    if (format == FORMAT_IMA_ADPCM) {
+        const int expected = (blockAlign - 4 * channels) * 2 / channels + 1;
+        if (samplesPerBlock <= 0 || samplesPerBlock > expected)
+            samplesPerBlock = expected;
+        readBuffer.resize(blockAlign);
+        sourceBuffer.resize(samplesPerBlock * channels);
+    } else {
+        blockAlign = 2 * channels;
+        samplesPerBlock = PCM_CHUNK_FRAMES;
+        readBuffer.resize(PCM_CHUNK_FRAMES * blockAlign);
+        sourceBuffer.resize(PCM_CHUNK_FRAMES * channels);
+    }
+
+    setOutputRate(rate);
+    return rewind();
+}
+
+void AudioStream::setOutputRate(int rate)
+{
+    if (rate <= 0 || !sourceRate) return;
+    outputRate = rate;
+    step = quint32((qint64(sourceRate) << 16) / outputRate);
+}
+
+void AudioStream::close()
+{
+    if (file.isOpen())
+        file.close();
+    dataStart = 0;
+    dataSize = 0;
+    dataRead = 0;
+    sourceFrames = 0;
+    sourceIndex = 0;
+    primed = false;
+    finished = false;
+}
+
+bool AudioStream::rewind()
+{
+    if (!file.seek(dataStart))
+        return false;
+    dataRead = 0;
+    sourceFrames = 0;
+    sourceIndex = 0;
+    frac = 0;
+    primed = false;
+    finished = false;
+    return true;
+}
+
+// 전체 길이(출력 프레임) 추정치 - 효과음 전체 디코딩 시 버퍼 예약용
+int AudioStream::estimatedFrames() const
+{
+    if (!channels || !sourceRate || !outputRate) return 0;
+    qint64 srcFrames;
+    if (format == FORMAT_IMA_ADPCM)
+        srcFrames = (dataSize / blockAlign + 1) * samplesPerBlock;
+    else
+        srcFrames = dataSize / (2 * channels);
+    return int(srcFrames * outputRate / sourceRate) + 1;
+}
+
+int AudioStream::bufferBytes() const
+{
+    return readBuffer.size() + sourceBuffer.size() * int(sizeof(qint16));
+}
+
+// IMA ADPCM 블록 1개 디코딩, 디코딩된 프레임 수 반환
+int AudioStream::decodeImaBlock(const uchar *block, int bytes)
+{
+    int predictor[2];
+    int index[2];
+    qint16 *dst = sourceBuffer.data();
+    for (int c = 0; c < channels; ++c) {
+        predictor[c] = qint16(readLE16(block + c * 4));
+        index[c] = qBound(0, int(block[c * 4 + 2]), 88);
+        dst[c] = qint16(predictor[c]);
+    }
+
+    // 블록 헤더 이후: 채널마다 4바이트(8샘플)씩 번갈아 배치, 각 바이트는 하위 니블이 먼저
+    const uchar *data = block + 4 * channels;
+    const int dataBytes = bytes - 4 * channels;
+    const int groups = dataBytes / (4 * channels);
+    int frames = 1;
+    for (int g = 0; g < groups && frames < samplesPerBlock; ++g) {
+        for (int c = 0; c < channels; ++c) {
+            const uchar *p = data + (g * channels + c) * 4;
+            for (int i = 0; i < 8; ++i) {
+                const int nibble = (i & 1) ? (p[i >> 1] >> 4) : (p[i >> 1] & 0x0F);
+                const int frame = frames + i;
+                if (frame < samplesPerBlock)
+                    dst[frame * channels + c] = imaDecodeNibble(nibble, predictor[c], index[c]);
+            }
+        }
+        frames = qMin(frames + 8, samplesPerBlock);
+    }
+    return frames;
+}
+
+// 다음 블록을 읽어 sourceBuffer에 디코딩 (데이터 끝이면 false)
+bool AudioStream::decodeNextBlock()
+{
+    const qint64 remaining = dataSize - dataRead;
+    if (remaining <= 0) return false;
+
+    const int want = int(qMin<qint64>(readBuffer.size(), remaining));
+    const qint64 got = file.read(reinterpret_cast<char *>(readBuffer.data()), want);
+    if (got <= 0) return false;
+    dataRead += got;
+
+    if (format == FORMAT_IMA_ADPCM) {
+        if (got <= 4 * channels) return false;
+        sourceFrames = decodeImaBlock(readBuffer.constData(), int(got));
+    } else {
+        sourceFrames = int(got) / (2 * channels);
+        const uchar *p = readBuffer.constData();
+        qint16 *dst = sourceBuffer.data();
+        for (int i = 0; i < sourceFrames * channels; ++i)
+            dst[i] = qint16(readLE16(p + i * 2));
+    }
+    sourceIndex = 0;
+    return sourceFrames > 0;
+}
+
+bool AudioStream::nextSourceFrame(qint16 frame[2])
+{
+    if (sourceIndex >= sourceFrames && !decodeNextBlock())
+        return false;
+    const qint16 *src = sourceBuffer.constData() + sourceIndex * channels;
+    frame[0] = src[0];
+    frame[1] = channels == 2 ? src[1] : src[0];
+    ++sourceIndex;
+    return true;
+}
+
+int AudioStream::read(qint16 *out, int frames, bool loop)
+{
+    if (!file.isOpen()) return 0;
+
+    int produced = 0;
+    bool rewound = false;
+    while (produced < frames && !finished) {
+        if (!primed) {
+            if (!nextSourceFrame(frameA) || !nextSourceFrame(frameB)) {
+                // 데이터가 비어 있으면 반복 재생이라도 한 번만 되감고 종료
+                if (loop && !rewound && rewind()) {
+                    rewound = true;
+                    continue;
+                }
+                finished = true;
+                break;
+            }
+            primed = true;
+        }
+
+        // 차이(최대 ±65535) × 분수(최대 65535)는 int 범위를 넘으므로 64bit로 곱함
+        const qint64 f = qint64(frac);
+        out[produced * 2] = qint16(frameA[0] + (((frameB[0] - frameA[0]) * f) >> 16));
+        out[produced * 2 + 1] = qint16(frameA[1] + (((frameB[1] - frameA[1]) * f) >> 16));
+        ++produced;
+
+        frac += step;
+        while (frac >= 0x10000u) {
+            frac -= 0x10000u;
+            qint16 next[2];
+            if (!nextSourceFrame(next)) {
+                if (loop && rewind()) {
+                    rewound = true;
+                } else {
+                    finished = true;
+                }
+                break;
+            }
+            frameA[0] = frameB[0];
+            frameA[1] = frameB[1];
+            frameB[0] = next[0];
+            frameB[1] = next[1];
+        }
+    }
+    return produced;
+}
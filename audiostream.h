@@ -0,0 +1,68 @@
+#ifndef AUDIOSTREAM_H
+#define AUDIOSTREAM_H
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+
+// WAV 스트리밍 디코더 (PCM 16bit / IMA ADPCM)
+// 파일 전체를 메모리에 올리지 않고 블록 단위로 읽어 디코딩하므로 곡 길이와 무관하게 메모리 사용량이 일정함
+// open()은 헤더만 읽고 버퍼를 한 번 할당하며, read()는 할당 없이 오디오 스레드에서 호출 가능
+// 파일은 QIODevice::Unbuffered로 열어 블록마다 read() 시스템 호출 한 번으로 블록 버퍼에 바로 읽음
+class AudioStream
+{
+public:
+    AudioStream();
+    ~AudioStream();
+
+    bool open(const QString &file, int outputRate);
+    void close();
+    // 재생 중에도 호출 가능 (할당 없이 리샘플 간격만 다시 계산, 장치가 요청과 다른 샘플레이트로 열린 경우)
+    void setOutputRate(int rate);
+
+    // 엔진 포맷(인터리브 스테레오 16bit, outputRate)으로 최대 frames 프레임 생성
+    // 반환값이 frames보다 작으면 스트림 끝 (loop가 true면 처음부터 다시 재생)
+    int read(qint16 *out, int frames, bool loop);
+
+    bool isOpen() const { return file.isOpen(); }
+    int rate() const { return outputRate; }
+    bool isCompressed() const { return format == FORMAT_IMA_ADPCM; }
+    int estimatedFrames() const;
+    int bufferBytes() const;
+
+private:
+    static const int FORMAT_PCM = 1;
+    static const int FORMAT_IMA_ADPCM = 0x11;
+    static const int PCM_CHUNK_FRAMES = 1024;
+
+    bool rewind();
+    bool decodeNextBlock();
+    bool nextSourceFrame(qint16 frame[2]);
+    int decodeImaBlock(const uchar *block, int bytes);
+
+    QFile file;
+    int format;
+    int channels;
+    int sourceRate;
+    int outputRate;
+    int blockAlign;
+    int samplesPerBlock;
+    qint64 dataStart;
+    qint64 dataSize;
+    qint64 dataRead;
+
+    QVector<uchar> readBuffer;    // 압축/원본 블록 1개
+    QVector<qint16> sourceBuffer; // 디코딩된 블록 (소스 채널 수 인터리브)
+    int sourceFrames;
+    int sourceIndex;
+
+    // 선형 보간 리샘플러 상태 (16.16 고정소수점)
+    quint32 step;
+    quint32 frac;
+    qint16 frameA[2];
+    qint16 frameB[2];
+    bool primed;
+    bool finished;
+};
+
+#endif // AUDIOSTREAM_H
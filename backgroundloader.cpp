@@ -0,0 +1,86 @@
+#include "backgroundloader.h"
+#include <QtConcurrent/QtConcurrentRun>
+#include <QPainter>
+#include <QScreen>
+#include <QElapsedTimer>
+#include <QDebug>
+
+BackgroundLoader::BackgroundLoader(const QString &file, QObject *parent)
+    : QObject(parent)
+    , fileName(file)
+    , pendingFormat(QImage::Format_RGB32)
+    , pendingParallax(false)
+    , runningFormat(QImage::Format_RGB32)
+    , runningParallax(false)
+{
+    connect(&watcher, &QFutureWatcher<QImage>::finished, this, &BackgroundLoader::onFinished);
+}
+
+BackgroundLoader::~BackgroundLoader()
+{
+    // 작업 스레드가 끝날 때까지 기다림 (결과는 버림)
+    watcher.disconnect();
+    watcher.waitForFinished();
+}
+
+QImage::Format BackgroundLoader::nativeFormat(const QScreen *screen)
+{
+    if (screen && screen->depth() == 16)
+        return QImage::Format_RGB16;
+    return QImage::Format_RGB32;
+}
+
+void BackgroundLoader::request(const QSize &viewSize, QImage::Format format, bool parallax)
+{
+    if (viewSize.isEmpty()) return;
+    if (viewSize == pendingSize && format == pendingFormat && parallax == pendingParallax) return;
+    pendingSize = viewSize;
+    pendingFormat = format;
+    pendingParallax = parallax;
+    if (!watcher.isRunning())
+        start();
+}
+
+void BackgroundLoader::start()
+{
+    runningSize = pendingSize;
+    runningFormat = pendingFormat;
+    runningParallax = pendingParallax;
+    watcher.setFuture(QtConcurrent::run(&BackgroundLoader::prepare, fileName, pendingSize, pendingFormat, pendingParallax));
+}
+
+void BackgroundLoader::onFinished()
+{
+    // 처리 중에 다른 요청이 들어왔으면 결과를 버리고 다시 시작
+    if (runningSize != pendingSize || runningFormat != pendingFormat || runningParallax != pendingParallax) {
+        start();
+        return;
+    }
+    emit ready(watcher.result(), runningSize);
+}
+
+// 작업 스레드에서 실행 (QPixmap이 아닌 QImage만 사용)
+QImage BackgroundLoader::prepare(const QString &file, const QSize &viewSize, QImage::Format format, bool parallax)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QImage source;
+    if (!source.load(file)) {
+        qDebug() << "BackgroundLoader: failed to load" << file;
+        return QImage();
+    }
+    const QImage scaled = source.scaled(viewSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation).convertToFormat(format);
+    if (!parallax) {
+        qDebug() << "BackgroundLoader:" << scaled.size() << scaled.format() << timer.elapsed() << "ms";
+        return scaled;
+    }
+
+    QImage strip(viewSize.width() * 2, viewSize.height(), format);
+    QPainter painter(&strip);
+    painter.drawImage(0, 0, scaled);
+    painter.drawImage(viewSize.width(), 0, scaled.mirrored(true, false));
+    painter.end();
+    qDebug() << "BackgroundLoader: parallax strip" << strip.size() << strip.format() << timer.elapsed() << "ms";
+    return strip;
+}
@@ -0,0 +1,53 @@
+#ifndef BACKGROUNDLOADER_H
+#define BACKGROUNDLOADER_H
+
+#include <QObject>
+#include <QImage>
+#include <QSize>
+#include <QString>
+#include <QFutureWatcher>
+
+class QScreen;
+
+// 배경 에셋 파이프라인
+// 로드(NFS) → 화면 크기로 스케일 → 화면 고유 픽셀 포맷으로 변환을 작업 스레드에서 수행
+// 그리기 경로에서는 완성된 이미지를 복사만 함
+// 패럴랙스 모드에서는 원본과 좌우 반전본을 가로로 이어 붙인 띠(화면 너비 2배)를 만들어
+// 스크롤 위치와 관계없이 이음매 없이 반복되도록 함
+class BackgroundLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit BackgroundLoader(const QString &file, QObject *parent = nullptr);
+    ~BackgroundLoader();
+
+    // 같은 요청이 진행 중이거나 이미 완료됐으면 무시, 진행 중에 다른 크기가 요청되면 끝난 뒤 이어서 처리
+    void request(const QSize &viewSize, QImage::Format format, bool parallax);
+    bool isPending() const { return watcher.isRunning(); }
+    QSize requestedSize() const { return pendingSize; }
+
+    // 불투명 배경을 변환 없이 복사할 수 있는 포맷 (16bit 화면이면 RGB16)
+    static QImage::Format nativeFormat(const QScreen *screen);
+
+signals:
+    void ready(const QImage &image, const QSize &viewSize);
+
+private slots:
+    void onFinished();
+
+private:
+    static QImage prepare(const QString &file, const QSize &viewSize, QImage::Format format, bool parallax);
+    void start();
+
+    QString fileName;
+    QFutureWatcher<QImage> watcher;
+    QSize pendingSize;          // 마지막으로 요청된 크기
+    QImage::Format pendingFormat;
+    bool pendingParallax;
+    QSize runningSize;          // 작업 스레드에서 처리 중인 요청
+    QImage::Format runningFormat;
+    bool runningParallax;
+};
+
+#endif // BACKGROUNDLOADER_H
@@ -0,0 +1,103 @@
+// 플레이어-기둥 정밀 충돌(1비트 마스크) 벤치마크
+// 빌드: g++ -O2 -std=c++11 -fPIC collisionbench.cpp collisionmask.cpp pillarrenderer.cpp -o collisionbench $(pkg-config --cflags --libs Qt5Gui)
+// 사용법: QT_QPA_PLATFORM=offscreen ./collisionbench [frames]
+// 게임과 같은 에셋(/mnt/nfs/player2.png, 기둥 이미지, 없으면 게임과 같은 대체 스프라이트)으로
+// 기둥 한 쌍이 화면을 지나가는 동안 플레이어를 위아래로 움직이며 프레임마다 광역(AABB) → 정밀(마스크) 판정을 측정
+// 정밀 단계는 AABB를 통과한 프레임에만 실행되며, 프레임당 1us 이하인지 확인
+
+#include <QGuiApplication>
+#include <QElapsedTimer>
+#include <QPainter>
+#include <QVector>
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "collisionmask.h"
+#include "pillarrenderer.h"
+
+static const int VIEW_WIDTH = 1920;
+static const int VIEW_HEIGHT = 1080;
+static const int PLAYER_SIZE = 30;              // GameWindow::PLAYER_SIZE
+static const int PLAYER_DISPLAY_SIZE = PLAYER_SIZE * 3;
+static const int OBSTACLE_WIDTH = 40;           // GameWindow::OBSTACLE_WIDTH
+static const int OBSTACLE_GAP = 200;            // GameWindow::OBSTACLE_GAP
+static const int SPEED = 3;
+
+static QPixmap loadPlayerSprite()
+{
+    QPixmap raw;
+    if (raw.load("/mnt/nfs/player2.png"))
+        return raw.scaled(PLAYER_DISPLAY_SIZE, PLAYER_DISPLAY_SIZE, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    // 게임과 같은 대체 스프라이트 (흰색 원)
+    QPixmap circle(PLAYER_SIZE, PLAYER_SIZE);
+    circle.fill(Qt::transparent);
+    QPainter painter(&circle);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(Qt::white);
+    painter.drawEllipse(0, 0, PLAYER_SIZE, PLAYER_SIZE);
+    return circle;
+}
+
+int main(int argc, char **argv)
+{
+    QGuiApplication app(argc, argv);
+    const int frames = argc >= 2 && atoi(argv[1]) > 0 ? atoi(argv[1]) : 200000;
+
+    PillarRenderer pillars;
+    pillars.load();
+    const CollisionMask playerMask = CollisionMask::fromPixmap(loadPlayerSprite());
+    printf("Player mask %dx%d (%d opaque px), pillar drawn width %d\n",
+           playerMask.width(), playerMask.height(), playerMask.opaqueCount(), pillars.drawnWidth());
+
+    const int gapY = VIEW_HEIGHT / 2;
+    const QRect top(0, 0, OBSTACLE_WIDTH, gapY - OBSTACLE_GAP / 2);
+    const QRect bottom(0, gapY + OBSTACLE_GAP / 2, OBSTACLE_WIDTH, VIEW_HEIGHT - gapY - OBSTACLE_GAP / 2);
+    const int margin = qMax(0, (pillars.drawnWidth() - OBSTACLE_WIDTH + 1) / 2);
+
+    QVector<qint64> samples;
+    samples.reserve(frames);
+    int aabbHits = 0;
+    int pixelHits = 0;
+    QElapsedTimer timer;
+    for (int f = 0; f < frames; ++f) {
+        // 기둥은 오른쪽에서 왼쪽으로, 플레이어는 틈 주변을 위아래로 (틈 가장자리를 스치는 경우가 많도록)
+        const int pillarX = VIEW_WIDTH - (f * SPEED) % (VIEW_WIDTH + 200);
+        const int playerY = gapY - PLAYER_SIZE / 2 + int(150 * sin(f * 0.013));
+        const QRect player(50, playerY, PLAYER_SIZE, PLAYER_SIZE);
+        const QRect sprite(player.x() + (player.width() - playerMask.width()) / 2,
+                           player.y() + (player.height() - playerMask.height()) / 2,
+                           playerMask.width(), playerMask.height());
+        const QRect query = sprite.adjusted(-margin, 0, margin, 0);
+        const QRect topRect = top.translated(pillarX, 0);
+        const QRect bottomRect = bottom.translated(pillarX, 0);
+
+        const bool topCandidate = query.intersects(topRect);
+        const bool bottomCandidate = query.intersects(bottomRect);
+        if (!topCandidate && !bottomCandidate) continue;
+        ++aabbHits;
+
+        timer.start();
+        bool hit = topCandidate && pillars.collides(topRect, true, playerMask, sprite.topLeft());
+        if (!hit && bottomCandidate)
+            hit = pillars.collides(bottomRect, false, playerMask, sprite.topLeft());
+        samples.append(timer.nsecsElapsed());
+        if (hit) ++pixelHits;
+    }
+
+    if (samples.isEmpty()) {
+        printf("No AABB candidates\n");
+        return 1;
+    }
+    qint64 total = 0;
+    for (qint64 s : samples) total += s;
+    std::sort(samples.begin(), samples.end());
+    const double avgUs = total / 1000.0 / samples.size();
+    const double p99Us = samples[int(samples.size() * 0.99)] / 1000.0;
+    printf("Frames: %d, AABB candidates %d, pixel hits %d (AABB-only would report %d)\n",
+           frames, aabbHits, pixelHits, aabbHits);
+    printf("Narrow phase per frame: avg %.3f us, p99 %.3f us, max %.3f us\n",
+           avgUs, p99Us, samples.last() / 1000.0);
+    printf("Result: %s\n", p99Us < 1.0 ? "UNDER 1 us PER FRAME" : "OVER 1 us PER FRAME");
+    return 0;
+}
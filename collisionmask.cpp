@@ -0,0 +1,96 @@
+#include "collisionmask.h"
+
+CollisionMask::CollisionMask()
+    : w(0)
+    , h(0)
+    , wordsPerRow(0)
+{
+}
+
+CollisionMask::CollisionMask(int width, int height)
+    : w(qMax(0, width))
+    , h(qMax(0, height))
+    , wordsPerRow((w + 63) / 64)
+{
+    words.fill(0, wordsPerRow * h);
+}
+
+CollisionMask CollisionMask::fromImage(const QImage &image, int alphaThreshold)
+{
+    const QImage argb = image.convertToFormat(QImage::Format_ARGB32);
+    CollisionMask mask(argb.width(), argb.height());
+    for (int y = 0; y < mask.h; ++y) {
+        const QRgb *line = reinterpret_cast<const QRgb *>(argb.constScanLine(y));
+        for (int x = 0; x < mask.w; ++x) {
+            if (qAlpha(line[x]) >= alphaThreshold)
+                mask.setBit(x, y);
+        }
+    }
+    return mask;
+}
+
+CollisionMask CollisionMask::fromPixmap(const QPixmap &pixmap, int alphaThreshold)
+{
+    if (pixmap.isNull()) return CollisionMask();
+    QImage image = pixmap.toImage();
+    const qreal ratio = pixmap.devicePixelRatio();
+    if (ratio != 1.0) {
+        const QSize logical(qMax(1, qRound(image.width() / ratio)), qMax(1, qRound(image.height() / ratio)));
+        image = image.scaled(logical, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    }
+    return fromImage(image, alphaThreshold);
+}
+
+int CollisionMask::opaqueCount() const
+{
+    int count = 0;
+    for (quint64 word : words)
+        count += qPopulationCount(word);
+    return count;
+}
+
+bool CollisionMask::testBit(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= w || y >= h) return false;
+    return words[y * wordsPerRow + (x >> 6)] >> (x & 63) & 1;
+}
+
+quint64 CollisionMask::bits(int x, int y) const
+{
+    if (y < 0 || y >= h || x >= w || x <= -64) return 0;
+    const quint64 *row = words.constData() + y * wordsPerRow;
+    if (x < 0)
+        return row[0] << -x;
+    const int index = x >> 6;
+    const int shift = x & 63;
+    quint64 result = row[index] >> shift;
+    if (shift && index + 1 < wordsPerRow)
+        result |= row[index + 1] << (64 - shift);
+    return result;
+}
+
+bool CollisionMask::overlaps(const QPoint &at, const CollisionMask &other, const QPoint &otherAt,
+                             const QRect &clip, bool tileOther) const
+{
+    if (isNull() || other.isNull()) return false;
+    QRect region = QRect(at, size()) & clip;
+    if (tileOther)
+        region &= QRect(otherAt.x(), region.y(), other.w, region.height());
+    else
+        region &= QRect(otherAt, other.size());
+    if (region.isEmpty()) return false;
+
+    const int right = region.x() + region.width();
+    for (int y = region.y(); y < region.y() + region.height(); ++y) {
+        int otherRow = y - otherAt.y();
+        if (tileOther)
+            otherRow = ((otherRow % other.h) + other.h) % other.h;
+        for (int x = region.x(); x < right; x += 64) {
+            quint64 both = bits(x - at.x(), y - at.y()) & other.bits(x - otherAt.x(), otherRow);
+            if (right - x < 64)
+                both &= (quint64(1) << (right - x)) - 1;
+            if (both) return true;
+        }
+    }
+    return false;
+}
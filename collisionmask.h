@@ -0,0 +1,48 @@
+#ifndef COLLISIONMASK_H
+#define COLLISIONMASK_H
+
+#include <QImage>
+#include <QPixmap>
+#include <QPoint>
+#include <QRect>
+#include <QVector>
+
+// 1비트 충돌 마스크 (불투명 픽셀 = 1)
+// 로드 시 스프라이트 알파에서 한 번만 만들고, 판정은 행마다 64픽셀씩 비트 AND로 처리
+// 한 행은 64비트 워드 여러 개 (워드 k의 비트 i = 픽셀 k * 64 + i), 너비 밖의 비트는 항상 0
+class CollisionMask
+{
+public:
+    CollisionMask();
+    CollisionMask(int width, int height);   // 모두 투명
+
+    // 알파가 alphaThreshold 이상인 픽셀을 불투명으로 취급
+    static CollisionMask fromImage(const QImage &image, int alphaThreshold = 128);
+    // 고해상도 픽스맵은 논리 크기로 줄여서 만듦 (게임 좌표와 1:1)
+    static CollisionMask fromPixmap(const QPixmap &pixmap, int alphaThreshold = 128);
+
+    bool isNull() const { return w == 0 || h == 0; }
+    int width() const { return w; }
+    int height() const { return h; }
+    QSize size() const { return QSize(w, h); }
+    int opaqueCount() const;
+
+    void setBit(int x, int y) { words[y * wordsPerRow + (x >> 6)] |= quint64(1) << (x & 63); }
+    bool testBit(int x, int y) const;
+
+    // 행 y의 픽셀 x ~ x + 63을 비트 0 ~ 63으로 꺼냄 (마스크 밖은 0)
+    quint64 bits(int x, int y) const;
+
+    // 이 마스크를 at에, other를 otherAt에 놓았을 때 clip 안에서 둘 다 불투명한 픽셀이 있는지
+    // tileOther면 other를 otherAt.y() 기준으로 세로 반복 (기둥 몸통 타일)
+    bool overlaps(const QPoint &at, const CollisionMask &other, const QPoint &otherAt,
+                  const QRect &clip, bool tileOther = false) const;
+
+private:
+    int w;
+    int h;
+    int wordsPerRow;
+    QVector<quint64> words;
+};
+
+#endif // COLLISIONMASK_H
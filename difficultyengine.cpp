@@ -0,0 +1,98 @@
+#include "difficultyengine.h"
+#include <climits>
+
+// 보드 프로파일 (첫 항목이 기본값)
+// classic은 난이도 엔진 이전의 고정값 (3픽셀/스텝, 2초 간격, 틈 200)
+static const DifficultyEngine::Profile profiles[] = {
+    //  이름        시작 속도      최대 속도      간격(시작/최소) 틈(시작/최소) 점수  초
+    { "normal",   3 * 256,      6 * 256,      120, 84,        200, 140,     150, 300 },
+    { "classic",  3 * 256,      3 * 256,      120, 120,       200, 200,     0,   0   },
+    { "practice", 2 * 256,      3 * 256,      150, 120,       240, 200,     300, 600 },
+    { "hard",     4 * 256,      9 * 256,      100, 66,        170, 110,     100, 180 }
+};
+
+DifficultyEngine::DifficultyEngine()
+    : active(&profiles[0])
+    , stepHz(60)
+    , level(0)
+    , scrollSpeed(0)
+    , interval(0)
+    , gap(0)
+    , remainder(0)
+    , scrolled(0)
+{
+    reset(profiles[0], stepHz);
+}
+
+int DifficultyEngine::profileCount()
+{
+    return int(sizeof(profiles) / sizeof(profiles[0]));
+}
+
+const DifficultyEngine::Profile &DifficultyEngine::profileAt(int index)
+{
+    return profiles[qBound(0, index, profileCount() - 1)];
+}
+
+const DifficultyEngine::Profile &DifficultyEngine::profile(const QString &name)
+{
+    for (int i = 0; i < profileCount(); ++i) {
+        if (name == QLatin1String(profiles[i].name))
+            return profiles[i];
+    }
+    return defaultProfile();
+}
+
+const DifficultyEngine::Profile &DifficultyEngine::defaultProfile()
+{
+    return profiles[0];
+}
+
+void DifficultyEngine::reset(const Profile &profile, int hz)
+{
+    active = &profile;
+    stepHz = hz;
+    remainder = 0;
+    scrolled = 0;
+    apply(0);
+}
+
+void DifficultyEngine::update(int score, quint64 steps)
+{
+    const Profile &p = *active;
+    qint64 progress = 0;
+    if (p.pointsToMax > 0)
+        progress += qint64(score) * 1000 / p.pointsToMax;
+    if (p.secondsToMax > 0)
+        progress += qint64(steps) * 1000 / (qint64(p.secondsToMax) * stepHz);
+    apply(int(qMin<qint64>(progress, 1000)));
+}
+
+int DifficultyEngine::advance()
+{
+    remainder += scrollSpeed;
+    scrolled = remainder / SPEED_ONE;
+    remainder -= scrolled * SPEED_ONE;
+    return scrolled;
+}
+
+int DifficultyEngine::minTravelSteps(int clearance) const
+{
+    // 간격은 줄고 속도는 늘기만 하지만 둘의 조합이 단조롭지 않으므로 구간을 나눠 최솟값
+    DifficultyEngine probe(*this);
+    int best = INT_MAX;
+    for (int progress = 0; progress <= 1000; progress += 50) {
+        probe.apply(progress);
+        best = qMin(best, probe.interval - (clearance * SPEED_ONE + probe.scrollSpeed - 1) / probe.scrollSpeed);
+    }
+    return qMax(0, best);
+}
+
+void DifficultyEngine::apply(int progress)
+{
+    const Profile &p = *active;
+    level = progress;
+    scrollSpeed = qMax(1, p.startSpeed + (p.maxSpeed - p.startSpeed) * progress / 1000);
+    interval = qMax(1, p.startInterval + (p.minInterval - p.startInterval) * progress / 1000);
+    gap = p.startGap + (p.minGap - p.startGap) * progress / 1000;
+}
@@ -0,0 +1,66 @@
+#ifndef DIFFICULTYENGINE_H
+#define DIFFICULTYENGINE_H
+
+#include <QString>
+#include <QtGlobal>
+
+// 난이도 엔진: 점수와 경과 스텝 수로 스크롤 속도, 장애물 생성 간격, 틈 크기를 조절
+// 시뮬레이션 스텝마다 update()로 갱신되므로 화면 주사율/부하와 무관하게 결정적
+// 속도는 1/256 픽셀 단위 고정소수점 (스텝마다 정수 픽셀로 누적해 이동, 부동소수점 없음)
+// 보드마다 프로파일을 골라 씀 (DIFFICULTY 환경 변수, 멀티플레이어는 호스트의 프로파일)
+class DifficultyEngine
+{
+public:
+    static const int SPEED_ONE = 256;   // 속도 1픽셀/스텝
+
+    // 시작값 → 최대 난이도 값 사이를 진행도(0~1000)에 비례해 보간
+    struct Profile {
+        const char *name;
+        int startSpeed;     // 스크롤 속도 (SPEED_ONE = 1픽셀/스텝)
+        int maxSpeed;
+        int startInterval;  // 장애물 쌍 생성 간격 (스텝)
+        int minInterval;
+        int startGap;       // 위/아래 장애물 사이 틈 (픽셀)
+        int minGap;
+        int pointsToMax;    // 이 점수에서 최대 난이도 (0이면 점수 무시)
+        int secondsToMax;   // 이 시간이 지나면 최대 난이도 (0이면 시간 무시, 점수와 합산)
+    };
+
+    DifficultyEngine();
+
+    static int profileCount();
+    static const Profile &profileAt(int index);
+    // 이름으로 찾음 (없으면 기본 프로파일)
+    static const Profile &profile(const QString &name);
+    static const Profile &defaultProfile();
+
+    void reset(const Profile &profile, int stepHz);
+    void update(int score, quint64 steps);
+    // 이번 스텝의 스크롤 거리 (소수 부분은 다음 스텝으로 누적)
+    int advance();
+
+    const Profile &currentProfile() const { return *active; }
+    int progress() const { return level; }          // 0~1000
+    int speed() const { return scrollSpeed; }       // SPEED_ONE 단위
+    int spawnInterval() const { return interval; }
+    int gapSize() const { return gap; }
+    int lastScroll() const { return scrolled; }     // 마지막 advance() 결과 (렌더 보간용)
+
+    // 이웃한 두 쌍 사이 빈 구간(clearance = 장애물 + 플레이어 너비)을 지나는 최소 스텝 수
+    // (프로파일 전 구간에서 가장 빡빡한 값, 레벨 생성기의 도달 가능 거리 계산용)
+    int minTravelSteps(int clearance) const;
+
+private:
+    void apply(int progress);
+
+    const Profile *active;
+    int stepHz;
+    int level;
+    int scrollSpeed;
+    int interval;
+    int gap;
+    int remainder;      // 누적된 소수 픽셀 (SPEED_ONE 단위)
+    int scrolled;
+};
+
+#endif // DIFFICULTYENGINE_H
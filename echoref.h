@@ -0,0 +1,58 @@
+#ifndef ECHOREF_H
+#define ECHOREF_H
+
+/*
+ * 에코 제거용 참조 신호 공유 메모리 (게임 오디오 엔진 → mic 프로세스)
+ *
+ * 오디오 엔진은 스피커로 내보내는 믹싱 결과를 16kHz 모노로 줄여 링 버퍼에 기록하고,
+ * 블록의 첫 샘플이 DAC에 도달하는 시각(CLOCK_MONOTONIC)을 함께 남긴다.
+ * mic 프로세스는 캡처 시각으로 링 버퍼 위치를 계산해 NLMS 필터의 참조 입력으로 사용한다.
+ * C(mic.c)와 C++(audioengine.cpp)에서 같이 사용하므로 C 문법만 사용한다.
+ */
+
+#include <stdint.h>
+
+#define ECHOREF_SHM_NAME "/pitchgame_echoref"
+#define ECHOREF_MAGIC 0x45524546u  /* "EREF" */
+#define ECHOREF_RATE 16000         /* mic.c SAMPLE_RATE와 동일 */
+#define ECHOREF_FRAMES 16384       /* 2의 거듭제곱, 약 1초 */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t rate;
+    uint32_t seq;            /* 홀수이면 메타데이터 갱신 중 (seqlock) */
+    uint32_t reserved;
+    uint64_t write_pos;      /* 지금까지 기록된 총 샘플 수 */
+    uint64_t anchor_pos;     /* anchor_time_ns에 DAC에 도달하는 샘플 위치 */
+    int64_t anchor_time_ns;
+    int16_t samples[ECHOREF_FRAMES];
+} echoref_t;
+
+/* 쓰기 측: 샘플을 먼저 기록한 뒤 메타데이터를 seqlock으로 갱신 */
+static inline void echoref_publish(echoref_t *ref, uint64_t write_pos, uint64_t anchor_pos, int64_t anchor_time_ns)
+{
+    __atomic_store_n(&ref->seq, ref->seq + 1, __ATOMIC_RELEASE);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    ref->write_pos = write_pos;
+    ref->anchor_pos = anchor_pos;
+    ref->anchor_time_ns = anchor_time_ns;
+    __atomic_store_n(&ref->seq, ref->seq + 1, __ATOMIC_RELEASE);
+}
+
+/* 읽기 측: 일관된 메타데이터를 얻으면 1, 실패하면 0 */
+static inline int echoref_snapshot(const echoref_t *ref, uint64_t *write_pos, uint64_t *anchor_pos, int64_t *anchor_time_ns)
+{
+    for (int attempt = 0; attempt < 4; ++attempt) {
+        uint32_t seq = __atomic_load_n(&ref->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1) continue;
+        *write_pos = ref->write_pos;
+        *anchor_pos = ref->anchor_pos;
+        *anchor_time_ns = ref->anchor_time_ns;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&ref->seq, __ATOMIC_ACQUIRE) == seq)
+            return 1;
+    }
+    return 0;
+}
+
+#endif /* ECHOREF_H */
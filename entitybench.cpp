@@ -0,0 +1,313 @@
+// 엔티티 컨테이너 스트레스 벤치마크 (이동/만료/플레이어 충돌 검사)
+// 빌드: g++ -O2 -std=c++11 -fPIC entitybench.cpp entitystore.cpp spatialgrid.cpp -o entitybench $(pkg-config --cflags --libs Qt5Core)
+// 사용법: ./entitybench [steps] [spawnPerStep]
+//         ./entitybench --broadphase [queries]   엔티티 수별 플레이어 충돌 질의 시간 (전체 검사 / x 정렬 창 / 균일 격자)
+// 게임보다 훨씬 높은 생성 빈도(탄막 모드 수준)로 세 가지 저장 방식의 스텝당 처리 시간과 재할당 횟수를 비교
+//   QVector  - 초기 방식: QVector<QRect>/구조체 배열 + removeAt
+//   Ring     - RingBuffer<QRect>/구조체 배열, 앞에서 O(1) 만료
+//   SoA      - EntityStore 필드별 배열, SIMD 이동/제거/충돌 검사
+
+#include <QVector>
+#include <QRect>
+#include <QPointF>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ringbuffer.h"
+#include "entitystore.h"
+#include "spatialgrid.h"
+
+static const int VIEW_WIDTH = 1920;
+static const int VIEW_HEIGHT = 1080;
+static const int OBSTACLE_WIDTH = 40;
+static const int SPEED = 3;
+static const int RING_CAPACITY = 1 << 14;   // 생성 빈도 16/스텝까지 (화면 통과 640스텝)
+static const int PLAYER_SIZE = 30;
+static const QRect PLAYER(50, VIEW_HEIGHT / 2, PLAYER_SIZE, PLAYER_SIZE);
+static const QRect PLAYER_BOUNDS(PLAYER.x() - 15, PLAYER.y() - 15, PLAYER_SIZE + 30, PLAYER_SIZE + 30);
+static const int STAR_SIZE = 60;
+
+struct Star {
+    QPointF pos;
+    bool active;
+    Star() : active(false) {}
+    Star(QPointF p) : pos(p), active(true) {}
+};
+
+struct Result {
+    double avgUs;
+    double p99Us;
+    double maxUs;
+    int reallocations;
+    int peakEntities;
+    int collisions;     // 결과가 같은지 확인용 (플레이어와 겹친 장애물 스텝 수 + 먹은 별 수)
+};
+
+static quint32 lcgState = 12345;
+static int nextRandom(int bound)
+{
+    lcgState = lcgState * 1103515245u + 12345u;
+    return int((lcgState >> 16) % quint32(bound));
+}
+
+static Result summarize(QVector<qint64> &samples, int reallocations, int peak, int collisions)
+{
+    Result r;
+    qint64 total = 0;
+    for (qint64 s : samples) total += s;
+    std::sort(samples.begin(), samples.end());
+    r.avgUs = total / 1000.0 / samples.size();
+    r.p99Us = samples[int(samples.size() * 0.99)] / 1000.0;
+    r.maxUs = samples.last() / 1000.0;
+    r.reallocations = reallocations;
+    r.peakEntities = peak;
+    r.collisions = collisions;
+    return r;
+}
+
+// 기존 updateGame 방식: 역순 루프 removeAt, 별은 25개를 넘으면 비활성 항목 removeAt
+static Result runVector(int steps, int spawnPerStep)
+{
+    QVector<QRect> obstacles;
+    QVector<Star> stars;
+    QVector<qint64> samples(steps);
+    int reallocations = 0;
+    int peak = 0;
+    int collisions = 0;
+    lcgState = 12345;
+    QElapsedTimer timer;
+    for (int step = 0; step < steps; ++step) {
+        const int obstacleCapacity = obstacles.capacity();
+        const int starCapacity = stars.capacity();
+        timer.start();
+        for (int s = 0; s < spawnPerStep; ++s) {
+            const int gapY = 200 + nextRandom(VIEW_HEIGHT - 400);
+            obstacles.append(QRect(VIEW_WIDTH, 0, OBSTACLE_WIDTH, gapY - 100));
+            obstacles.append(QRect(VIEW_WIDTH, gapY + 100, OBSTACLE_WIDTH, VIEW_HEIGHT - gapY - 100));
+            stars.append(Star(QPointF(VIEW_WIDTH + OBSTACLE_WIDTH / 2, gapY)));
+        }
+        for (int i = obstacles.size() - 1; i >= 0; --i) {
+            obstacles[i].translate(-SPEED, 0);
+            if (obstacles[i].x() + obstacles[i].width() < 0)
+                obstacles.removeAt(i);
+        }
+        for (const QRect &obstacle : obstacles) {
+            if (PLAYER.intersects(obstacle)) {
+                ++collisions;
+                break;
+            }
+        }
+        for (int i = stars.size() - 1; i >= 0; --i) {
+            Star &star = stars[i];
+            if (!star.active) continue;
+            star.pos.setX(star.pos.x() - SPEED);
+            if (star.pos.x() + STAR_SIZE / 2 < 0) {
+                star.active = false;
+                continue;
+            }
+            const QRect starRect(int(star.pos.x()) - STAR_SIZE / 2, int(star.pos.y()) - STAR_SIZE / 2, STAR_SIZE, STAR_SIZE);
+            if (PLAYER_BOUNDS.intersects(starRect)) {
+                star.active = false;
+                ++collisions;
+            }
+        }
+        if (stars.size() > 25) {
+            for (int i = stars.size() - 1; i >= 0; --i) {
+                if (!stars[i].active)
+                    stars.removeAt(i);
+            }
+        }
+        samples[step] = timer.nsecsElapsed();
+        if (obstacles.capacity() != obstacleCapacity) ++reallocations;
+        if (stars.capacity() != starCapacity) ++reallocations;
+        peak = std::max(peak, obstacles.size() + stars.size());
+    }
+    return summarize(samples, reallocations, peak, collisions);
+}
+
+// RingBuffer 방식: 모두 같은 속도이므로 만료 대상은 항상 앞쪽
+static Result runRing(int steps, int spawnPerStep)
+{
+    static RingBuffer<QRect, RING_CAPACITY> obstacles;
+    static RingBuffer<Star, RING_CAPACITY> stars;
+    obstacles.clear();
+    stars.clear();
+    QVector<qint64> samples(steps);
+    int dropped = 0;
+    int peak = 0;
+    int collisions = 0;
+    lcgState = 12345;
+    QElapsedTimer timer;
+    for (int step = 0; step < steps; ++step) {
+        timer.start();
+        for (int s = 0; s < spawnPerStep; ++s) {
+            const int gapY = 200 + nextRandom(VIEW_HEIGHT - 400);
+            if (obstacles.size() + 2 <= RING_CAPACITY) {
+                obstacles.append(QRect(VIEW_WIDTH, 0, OBSTACLE_WIDTH, gapY - 100));
+                obstacles.append(QRect(VIEW_WIDTH, gapY + 100, OBSTACLE_WIDTH, VIEW_HEIGHT - gapY - 100));
+            } else {
+                ++dropped;
+            }
+            if (!stars.append(Star(QPointF(VIEW_WIDTH + OBSTACLE_WIDTH / 2, gapY))))
+                ++dropped;
+        }
+        for (QRect &obstacle : obstacles)
+            obstacle.translate(-SPEED, 0);
+        while (!obstacles.isEmpty() && obstacles.first().x() + obstacles.first().width() < 0)
+            obstacles.removeFirst();
+        for (const QRect &obstacle : obstacles) {
+            if (PLAYER.intersects(obstacle)) {
+                ++collisions;
+                break;
+            }
+        }
+        for (Star &star : stars) {
+            if (!star.active) continue;
+            star.pos.setX(star.pos.x() - SPEED);
+            if (star.pos.x() + STAR_SIZE / 2 < 0) {
+                star.active = false;
+                continue;
+            }
+            const QRect starRect(int(star.pos.x()) - STAR_SIZE / 2, int(star.pos.y()) - STAR_SIZE / 2, STAR_SIZE, STAR_SIZE);
+            if (PLAYER_BOUNDS.intersects(starRect)) {
+                star.active = false;
+                ++collisions;
+            }
+        }
+        while (!stars.isEmpty() && !stars.first().active)
+            stars.removeFirst();
+        samples[step] = timer.nsecsElapsed();
+        peak = std::max(peak, obstacles.size() + stars.size());
+    }
+    if (dropped)
+        printf("Ring: %d spawns dropped (capacity %d)\n", dropped, RING_CAPACITY);
+    return summarize(samples, 0, peak, collisions);
+}
+
+// EntityStore 방식: 필드별 배열 전체를 SIMD로 이동/제거/충돌 검사
+static Result runSoA(int steps, int spawnPerStep)
+{
+    static EntityStore<RING_CAPACITY> obstacles;
+    static EntityStore<RING_CAPACITY> stars;
+    static int hits[RING_CAPACITY];
+    obstacles.clear();
+    stars.clear();
+    QVector<qint64> samples(steps);
+    int peak = 0;
+    int collisions = 0;
+    lcgState = 12345;
+    QElapsedTimer timer;
+    for (int step = 0; step < steps; ++step) {
+        timer.start();
+        for (int s = 0; s < spawnPerStep; ++s) {
+            const int gapY = 200 + nextRandom(VIEW_HEIGHT - 400);
+            if (obstacles.size() + 2 <= RING_CAPACITY) {
+                obstacles.append(QRect(VIEW_WIDTH, 0, OBSTACLE_WIDTH, gapY - 100));
+                obstacles.append(QRect(VIEW_WIDTH, gapY + 100, OBSTACLE_WIDTH, VIEW_HEIGHT - gapY - 100));
+            }
+            stars.append(QRect(VIEW_WIDTH + OBSTACLE_WIDTH / 2 - STAR_SIZE / 2, gapY - STAR_SIZE / 2, STAR_SIZE, STAR_SIZE));
+        }
+        obstacles.translate(-SPEED);
+        obstacles.cullLeft(0);
+        if (obstacles.intersects(PLAYER))
+            ++collisions;
+        stars.translate(-SPEED);
+        stars.cullLeft(0);
+        const int found = stars.overlaps(PLAYER_BOUNDS, hits, RING_CAPACITY);
+        for (int i = 0; i < found; ++i)
+            stars.kill(hits[i]);
+        collisions += found;
+        samples[step] = timer.nsecsElapsed();
+        peak = std::max(peak, obstacles.size() + stars.size());
+    }
+    return summarize(samples, 0, peak, collisions);
+}
+
+// 광역 단계 비교: 엔티티 n개 중 플레이어와 겹치는 것을 찾는 질의 1회 시간
+// 정렬 창은 같은 속도로 흐르는 장애물 배치, 격자는 위치가 제각각인 배치를 가정 (둘 다 전체 검사와 결과 비교)
+static void runBroadPhase(int entities, int queries)
+{
+    static EntityStore<RING_CAPACITY> sortedStore;
+    static int hits[RING_CAPACITY];
+    QVector<QRect> rects;
+    sortedStore.clear();
+    lcgState = 777;
+    const int spacing = qMax(1, VIEW_WIDTH * 4 / entities);   // 화면 4배 길이에 고르게 배치
+    for (int i = 0; i < entities; ++i) {
+        const QRect r(i * spacing, nextRandom(VIEW_HEIGHT - 100), OBSTACLE_WIDTH, 100);
+        rects.append(r);
+        sortedStore.append(r);
+    }
+    SpatialGrid grid(QRect(0, 0, VIEW_WIDTH * 4, VIEW_HEIGHT), 128, entities, QSize(OBSTACLE_WIDTH, 100));
+
+    QElapsedTimer timer;
+    qint64 scanNs = 0, windowNs = 0, gridNs = 0, buildNs = 0;
+    int scanHits = 0, windowHits = 0, gridHits = 0;
+    for (int q = 0; q < queries; ++q) {
+        // 질의마다 한 칸씩 흘려보냄 (정렬 창 시작 인덱스가 움직이는 경우 포함)
+        const QRect box(PLAYER.x() + q % (VIEW_WIDTH * 3), PLAYER.y(), PLAYER_SIZE, PLAYER_SIZE);
+
+        timer.start();
+        for (const QRect &r : rects) {
+            if (box.intersects(r)) ++scanHits;
+        }
+        scanNs += timer.nsecsElapsed();
+
+        timer.start();
+        windowHits += sortedStore.overlaps(box, hits, RING_CAPACITY);
+        windowNs += timer.nsecsElapsed();
+
+        if (q % 64 == 0) {
+            timer.start();
+            grid.clear();
+            for (int i = 0; i < rects.size(); ++i)
+                grid.insert(i, rects[i]);
+            buildNs += timer.nsecsElapsed();
+        }
+        timer.start();
+        const int candidates = grid.query(box, hits, RING_CAPACITY);
+        for (int i = 0; i < candidates; ++i) {
+            if (box.intersects(rects[hits[i]])) ++gridHits;
+        }
+        gridNs += timer.nsecsElapsed();
+    }
+    const int builds = (queries + 63) / 64;
+    printf("%6d entities: scan %8.1f ns  sorted window %6.1f ns  grid %6.1f ns (rebuild %7.2f us)  hits %d/%d/%d\n",
+           entities, double(scanNs) / queries, double(windowNs) / queries, double(gridNs) / queries,
+           buildNs / 1000.0 / builds, scanHits, windowHits, gridHits);
+}
+
+static void print(const char *name, const Result &r)
+{
+    printf("%-8s avg %8.2f us  p99 %8.2f us  max %8.2f us  reallocations %5d  peak entities %6d  collisions %d\n",
+           name, r.avgUs, r.p99Us, r.maxUs, r.reallocations, r.peakEntities, r.collisions);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc >= 2 && strcmp(argv[1], "--broadphase") == 0) {
+        const int queries = argc >= 3 && atoi(argv[2]) > 0 ? atoi(argv[2]) : 20000;
+        printf("Broad phase, %d queries per size (per-query average)\n", queries);
+        for (int n = 64; n <= RING_CAPACITY; n *= 4)
+            runBroadPhase(n, queries);
+        return 0;
+    }
+
+    const int steps = argc >= 2 && atoi(argv[1]) > 0 ? atoi(argv[1]) : 20000;
+    const int spawnPerStep = argc >= 3 && atoi(argv[2]) > 0 ? atoi(argv[2]) : 4;
+
+    printf("Steps: %d, spawn %d pairs + %d stars per step (game: 1 pair per 120 steps)\n",
+           steps, spawnPerStep, spawnPerStep);
+    const Result vector = runVector(steps, spawnPerStep);
+    const Result ring = runRing(steps, spawnPerStep);
+    const Result soa = runSoA(steps, spawnPerStep);
+    print("QVector", vector);
+    print("Ring", ring);
+    print("SoA", soa);
+    printf("SIMD backend: %s\n", EntitySimd::backendName());
+    printf("Speedup vs QVector (avg): ring %.1fx, SoA %.1fx\n",
+           ring.avgUs > 0 ? vector.avgUs / ring.avgUs : 0.0, soa.avgUs > 0 ? vector.avgUs / soa.avgUs : 0.0);
+    return 0;
+}
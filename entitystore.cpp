@@ -0,0 +1,140 @@
+#include "entitystore.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ENTITY_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ENTITY_SIMD_NEON
+#endif
+
+namespace EntitySimd {
+
+const char *backendName()
+{
+#if defined(ENTITY_SIMD_SSE2)
+    return "SSE2";
+#elif defined(ENTITY_SIMD_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+void translate(qint32 *values, int n, qint32 delta)
+{
+#if defined(ENTITY_SIMD_SSE2)
+    const __m128i d = _mm_set1_epi32(delta);
+    for (int i = 0; i < n; i += 4) {
+        __m128i *p = reinterpret_cast<__m128i *>(values + i);
+        _mm_store_si128(p, _mm_add_epi32(_mm_load_si128(p), d));
+    }
+#elif defined(ENTITY_SIMD_NEON)
+    const int32x4_t d = vdupq_n_s32(delta);
+    for (int i = 0; i < n; i += 4)
+        vst1q_s32(values + i, vaddq_s32(vld1q_s32(values + i), d));
+#else
+    for (int i = 0; i < n; ++i)
+        values[i] += delta;
+#endif
+}
+
+int cullLeft(const qint32 *x, const qint32 *w, qint32 *flags, int n, qint32 boundary, qint32 aliveBit)
+{
+#if defined(ENTITY_SIMD_SSE2)
+    const __m128i b = _mm_set1_epi32(boundary);
+    const __m128i alive = _mm_set1_epi32(aliveBit);
+    __m128i culled = _mm_setzero_si128();
+    for (int i = 0; i < n; i += 4) {
+        const __m128i right = _mm_add_epi32(_mm_load_si128(reinterpret_cast<const __m128i *>(x + i)),
+                                            _mm_load_si128(reinterpret_cast<const __m128i *>(w + i)));
+        __m128i *f = reinterpret_cast<__m128i *>(flags + i);
+        const __m128i fv = _mm_load_si128(f);
+        const __m128i isAlive = _mm_cmpeq_epi32(_mm_and_si128(fv, alive), alive);
+        const __m128i kill = _mm_and_si128(_mm_cmplt_epi32(right, b), isAlive);  // 전부 1 또는 0
+        _mm_store_si128(f, _mm_andnot_si128(_mm_and_si128(kill, alive), fv));
+        culled = _mm_sub_epi32(culled, kill);  // -1을 빼서 개수 누적
+    }
+    alignas(16) qint32 lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), culled);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(ENTITY_SIMD_NEON)
+    const int32x4_t b = vdupq_n_s32(boundary);
+    const int32x4_t alive = vdupq_n_s32(aliveBit);
+    uint32x4_t culled = vdupq_n_u32(0);
+    for (int i = 0; i < n; i += 4) {
+        const int32x4_t right = vaddq_s32(vld1q_s32(x + i), vld1q_s32(w + i));
+        const int32x4_t fv = vld1q_s32(flags + i);
+        const uint32x4_t isAlive = vtstq_s32(fv, alive);
+        const uint32x4_t kill = vandq_u32(vcltq_s32(right, b), isAlive);
+        vst1q_s32(flags + i, vbicq_s32(fv, vandq_s32(vreinterpretq_s32_u32(kill), alive)));
+        culled = vsubq_u32(culled, kill);
+    }
+    return int(vgetq_lane_u32(culled, 0) + vgetq_lane_u32(culled, 1) + vgetq_lane_u32(culled, 2) + vgetq_lane_u32(culled, 3));
+#else
+    int culled = 0;
+    for (int i = 0; i < n; ++i) {
+        if ((flags[i] & aliveBit) && x[i] + w[i] < boundary) {
+            flags[i] &= ~aliveBit;
+            ++culled;
+        }
+    }
+    return culled;
+#endif
+}
+
+// QRect::intersects와 같은 판정 (빈 사각형 제외, 경계가 맞닿기만 하면 겹치지 않음)
+void overlap(const qint32 *x, const qint32 *y, const qint32 *w, const qint32 *h, const qint32 *flags, int n,
+             const QRect &box, qint32 aliveBit, qint32 *hits)
+{
+    const qint32 bx0 = box.x(), by0 = box.y();
+    const qint32 bx1 = box.x() + box.width(), by1 = box.y() + box.height();
+#if defined(ENTITY_SIMD_SSE2)
+    const __m128i vbx0 = _mm_set1_epi32(bx0), vby0 = _mm_set1_epi32(by0);
+    const __m128i vbx1 = _mm_set1_epi32(bx1), vby1 = _mm_set1_epi32(by1);
+    const __m128i alive = _mm_set1_epi32(aliveBit);
+    const __m128i zero = _mm_setzero_si128();
+    for (int i = 0; i < n; i += 4) {
+        const __m128i x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(x + i));
+        const __m128i y0 = _mm_load_si128(reinterpret_cast<const __m128i *>(y + i));
+        const __m128i ww = _mm_load_si128(reinterpret_cast<const __m128i *>(w + i));
+        const __m128i hh = _mm_load_si128(reinterpret_cast<const __m128i *>(h + i));
+        const __m128i fv = _mm_load_si128(reinterpret_cast<const __m128i *>(flags + i));
+        __m128i hit = _mm_cmpeq_epi32(_mm_and_si128(fv, alive), alive);
+        hit = _mm_and_si128(hit, _mm_cmpgt_epi32(ww, zero));
+        hit = _mm_and_si128(hit, _mm_cmpgt_epi32(hh, zero));
+        hit = _mm_and_si128(hit, _mm_cmplt_epi32(x0, vbx1));
+        hit = _mm_and_si128(hit, _mm_cmpgt_epi32(_mm_add_epi32(x0, ww), vbx0));
+        hit = _mm_and_si128(hit, _mm_cmplt_epi32(y0, vby1));
+        hit = _mm_and_si128(hit, _mm_cmpgt_epi32(_mm_add_epi32(y0, hh), vby0));
+        _mm_store_si128(reinterpret_cast<__m128i *>(hits + i), hit);
+    }
+#elif defined(ENTITY_SIMD_NEON)
+    const int32x4_t vbx0 = vdupq_n_s32(bx0), vby0 = vdupq_n_s32(by0);
+    const int32x4_t vbx1 = vdupq_n_s32(bx1), vby1 = vdupq_n_s32(by1);
+    const int32x4_t alive = vdupq_n_s32(aliveBit);
+    const int32x4_t zero = vdupq_n_s32(0);
+    for (int i = 0; i < n; i += 4) {
+        const int32x4_t x0 = vld1q_s32(x + i);
+        const int32x4_t y0 = vld1q_s32(y + i);
+        const int32x4_t ww = vld1q_s32(w + i);
+        const int32x4_t hh = vld1q_s32(h + i);
+        uint32x4_t hit = vtstq_s32(vld1q_s32(flags + i), alive);
+        hit = vandq_u32(hit, vcgtq_s32(ww, zero));
+        hit = vandq_u32(hit, vcgtq_s32(hh, zero));
+        hit = vandq_u32(hit, vcltq_s32(x0, vbx1));
+        hit = vandq_u32(hit, vcgtq_s32(vaddq_s32(x0, ww), vbx0));
+        hit = vandq_u32(hit, vcltq_s32(y0, vby1));
+        hit = vandq_u32(hit, vcgtq_s32(vaddq_s32(y0, hh), vby0));
+        vst1q_s32(hits + i, vreinterpretq_s32_u32(hit));
+    }
+#else
+    for (int i = 0; i < n; ++i) {
+        const bool hit = (flags[i] & aliveBit) && w[i] > 0 && h[i] > 0
+            && x[i] < bx1 && x[i] + w[i] > bx0 && y[i] < by1 && y[i] + h[i] > by0;
+        hits[i] = hit ? -1 : 0;
+    }
+#endif
+}
+
+} // namespace EntitySimd
@@ -0,0 +1,183 @@
+#ifndef ENTITYSTORE_H
+#define ENTITYSTORE_H
+
+#include <QRect>
+#include <QtGlobal>
+
+// SIMD 커널 (SSE2 / NEON, 없으면 스칼라) - n은 4의 배수, 배열은 16바이트 정렬
+namespace EntitySimd {
+    void translate(qint32 *values, int n, qint32 delta);
+    // 살아 있고 오른쪽 끝(x + w)이 boundary보다 왼쪽인 항목의 aliveBit를 지우고 그 개수를 반환
+    int cullLeft(const qint32 *x, const qint32 *w, qint32 *flags, int n, qint32 boundary, qint32 aliveBit);
+    // 살아 있고 box와 겹치는 항목은 hits에 -1, 아니면 0
+    void overlap(const qint32 *x, const qint32 *y, const qint32 *w, const qint32 *h, const qint32 *flags, int n,
+                 const QRect &box, qint32 aliveBit, qint32 *hits);
+    const char *backendName();
+}
+
+// 구조체 배열 대신 필드별 배열(SoA)로 저장하는 엔티티 FIFO
+// 이동/화면 밖 제거/플레이어 충돌 검사를 사용 중인 구간(4개 단위로 맞춤, 랩어라운드 시 두 구간)에 대해 SIMD로 처리
+// 구간 안의 죽은 항목도 분기 없이 함께 계산하고 결과는 Alive 플래그로 거름
+// 엔티티는 오른쪽에서 생성되어 왼쪽으로 사라지므로 링 버퍼처럼 앞에서 O(1)로 꺼내며 재할당이 없음
+// 같은 속도로 움직이고 같은 너비이므로 항목은 x 순서로 정렬되어 있음 → 충돌 검사는 box의 x 구간에 걸친 항목만 봄
+// (창 크기 변경 등으로 순서가 어긋나게 추가되면 비워질 때까지 전체 검사로 되돌아감)
+template <int Capacity>
+class EntityStore
+{
+    Q_STATIC_ASSERT_X(Capacity >= 4 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two >= 4");
+
+public:
+    enum Flag {
+        Alive = 0x1,
+        TopObstacle = 0x2     // 위쪽 장애물 (캡이 아래에 붙음)
+    };
+
+    EntityStore() : head(0), count(0), sorted(true), cursor(0)
+    {
+        for (int i = 0; i < Capacity; ++i)
+            x[i] = y[i] = w[i] = h[i] = flags[i] = 0;
+    }
+
+    static int capacity() { return Capacity; }
+    // 맨 앞부터 맨 뒤까지의 항목 수 (중간의 죽은 항목 포함) - 인덱스 0이 가장 오래된 항목
+    int size() const { return count; }
+    bool isEmpty() const { return count == 0; }
+
+    bool append(const QRect &rect, qint32 extraFlags = 0)
+    {
+        if (count == Capacity) return false;
+        const int s = (head + count) & (Capacity - 1);
+        if (count > 0) {
+            const int last = (s - 1) & (Capacity - 1);
+            if (rect.x() < x[last] || rect.x() + rect.width() < x[last] + w[last])
+                sorted = false;
+        }
+        x[s] = rect.x();
+        y[s] = rect.y();
+        w[s] = rect.width();
+        h[s] = rect.height();
+        flags[s] = Alive | extraFlags;
+        ++count;
+        return true;
+    }
+
+    void clear()
+    {
+        for (int i = 0; i < Capacity; ++i)
+            flags[i] = 0;
+        head = 0;
+        count = 0;
+        sorted = true;
+        cursor = 0;
+    }
+
+    QRect rect(int i) const { const int s = slot(i); return QRect(x[s], y[s], w[s], h[s]); }
+    QPoint center(int i) const { const int s = slot(i); return QPoint(x[s] + w[s] / 2, y[s] + h[s] / 2); }
+    bool isAlive(int i) const { return flags[slot(i)] & Alive; }
+    bool hasFlag(int i, Flag flag) const { return flags[slot(i)] & flag; }
+    void kill(int i) { flags[slot(i)] &= ~qint32(Alive); }
+
+    void translate(int dx, int dy = 0)
+    {
+        forEachSpan([this, dx, dy](int begin, int n) {
+            if (dx) EntitySimd::translate(x + begin, n, dx);
+            if (dy) EntitySimd::translate(y + begin, n, dy);
+        });
+    }
+
+    // 오른쪽 끝이 boundary보다 왼쪽인 항목을 죽이고, 앞쪽의 죽은 항목을 꺼냄
+    // 반환값: 이번에 화면 밖으로 나가 죽은 항목 수
+    int cullLeft(int boundary)
+    {
+        int culled = 0;
+        forEachSpan([this, boundary, &culled](int begin, int n) {
+            culled += EntitySimd::cullLeft(x + begin, w + begin, flags + begin, n, boundary, Alive);
+        });
+        while (count > 0 && !(flags[head] & Alive)) {
+            flags[head] = 0;
+            head = (head + 1) & (Capacity - 1);
+            --count;
+            if (cursor > 0) --cursor;
+        }
+        if (count == 0) sorted = true;
+        return culled;
+    }
+
+    // 오른쪽 끝(x + w)이 left보다 오른쪽인 첫 항목의 인덱스 (없으면 size())
+    // 질의 x가 거의 고정이고 항목은 왼쪽으로만 움직이므로 지난 결과에서 몇 칸만 이동함
+    int firstEndingAfter(int left) const
+    {
+        if (!sorted) return 0;
+        int i = qMin(cursor, count);
+        while (i > 0 && x[slot(i - 1)] + w[slot(i - 1)] > left) --i;
+        while (i < count && x[slot(i)] + w[slot(i)] <= left) ++i;
+        cursor = i;
+        return i;
+    }
+
+    // box와 겹치는 살아 있는 항목의 인덱스를 오래된 순으로 최대 maxHits개 기록, 개수 반환
+    // 광역 단계: box의 x 구간에 걸친 항목(보통 2~4개)만 정밀 검사하므로 전체 항목 수와 무관
+    int overlaps(const QRect &box, int *hitIndices, int maxHits) const
+    {
+        const int first = firstEndingAfter(box.x());
+        const int right = box.x() + box.width();
+        int last = first;
+        if (sorted) {
+            while (last < count && x[slot(last)] < right) ++last;
+        } else {
+            last = count;
+        }
+        if (last == first) return 0;
+        forEachSpan(first, last - first, [this, &box](int begin, int n) {
+            EntitySimd::overlap(x + begin, y + begin, w + begin, h + begin, flags + begin, n, box, Alive, hits + begin);
+        });
+        int found = 0;
+        for (int i = first; i < last && found < maxHits; ++i) {
+            if (hits[slot(i)])
+                hitIndices[found++] = i;
+        }
+        return found;
+    }
+
+    bool intersects(const QRect &box) const
+    {
+        int index;
+        return overlaps(box, &index, 1) > 0;
+    }
+
+private:
+    int slot(int i) const { Q_ASSERT(i >= 0 && i < count); return (head + i) & (Capacity - 1); }
+
+    // 인덱스 first부터 n개를 덮는 4의 배수 길이 슬롯 구간마다 kernel(begin, n) 호출 (구간끼리 겹치지 않음)
+    // 전체 구간이면 가장자리의 빈 슬롯은 flags가 0이므로 계산에 섞여도 결과에 영향 없음
+    template <typename Kernel>
+    void forEachSpan(Kernel kernel) const { forEachSpan(0, count, kernel); }
+
+    template <typename Kernel>
+    void forEachSpan(int first, int n, Kernel kernel) const
+    {
+        if (n <= 0) return;
+        const int start = (head + first) & (Capacity - 1);
+        const int begin = start & ~3;
+        const int end = start + n;
+        if (end <= Capacity) {
+            kernel(begin, ((end + 3) & ~3) - begin);
+        } else {
+            kernel(begin, Capacity - begin);
+            kernel(0, qMin((end - Capacity + 3) & ~3, begin));
+        }
+    }
+
+    alignas(16) qint32 x[Capacity];
+    alignas(16) qint32 y[Capacity];
+    alignas(16) qint32 w[Capacity];
+    alignas(16) qint32 h[Capacity];
+    alignas(16) qint32 flags[Capacity];
+    alignas(16) mutable qint32 hits[Capacity];  // overlaps 계산용 작업 공간
+    int head;
+    int count;
+    bool sorted;            // 인덱스 순으로 x, x + w가 정렬되어 있는지
+    mutable int cursor;     // firstEndingAfter의 지난 결과
+};
+
+#endif // ENTITYSTORE_H
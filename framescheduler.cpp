@@ -0,0 +1,189 @@
+#include "framescheduler.h"
+#include "allocationcounter.h"
+#include <QDebug>
+
+static const qint64 frameBucketEdgesUs[FrameStats::FRAME_BUCKETS - 1] = {
+    8000, 12000, 16000, 20000, 25000, 33000, 50000
+};
+static const char *const frameBucketLabels[FrameStats::FRAME_BUCKETS] = {
+    "<8", "8", "12", "16", "20", "25", "33", ">=50"
+};
+
+FrameScheduler::FrameScheduler(int hz, QObject *parent)
+    : QObject(parent)
+    , active(false)
+    , vsync(false)
+    , tickInterval(16)
+    , stepHz(qMax(1, hz))
+    , stepNs(1000000000LL / qMax(1, hz))
+    , lastTickNs(0)
+    , accumulatorNs(0)
+{
+    timer.setTimerType(Qt::PreciseTimer);
+    connect(&timer, &QTimer::timeout, this, &FrameScheduler::onTimer);
+    resetStats();
+}
+
+void FrameScheduler::start()
+{
+    if (!clock.isValid())
+        clock.start();
+    // 멈춰 있던 시간은 따라잡지 않음
+    lastTickNs = clock.nsecsElapsed();
+    accumulatorNs = 0;
+    active = true;
+    timer.start(vsync ? VSYNC_WATCHDOG_MS : tickInterval);
+}
+
+void FrameScheduler::stop()
+{
+    active = false;
+    timer.stop();
+}
+
+void FrameScheduler::setVsyncDriven(bool enabled)
+{
+    vsync = enabled;
+    if (active)
+        timer.start(vsync ? VSYNC_WATCHDOG_MS : tickInterval);
+}
+
+void FrameScheduler::setTickInterval(int ms)
+{
+    tickInterval = qMax(1, ms);
+    if (active && !vsync)
+        timer.start(tickInterval);
+}
+
+void FrameScheduler::onTimer()
+{
+    // vsync 구동 중에는 스왑이 멈췄을 때(화면 변화 없음 등)만 직접 틱
+    if (vsync && clock.nsecsElapsed() - lastTickNs < VSYNC_WATCHDOG_MS * 1000000LL)
+        return;
+    tick();
+}
+
+void FrameScheduler::tick()
+{
+    if (!active) return;
+
+    const quint64 allocationsBefore = AllocationCounter::threadCount();
+    const qint64 now = clock.nsecsElapsed();
+    const qint64 frameNs = now - lastTickNs;
+    lastTickNs = now;
+    accumulatorNs += frameNs;
+
+    int steps = 0;
+    while (accumulatorNs >= stepNs && active) {
+        if (steps == MAX_STEPS_PER_FRAME) {
+            // 너무 밀렸으면 남은 시간을 버리고 느려진 것으로 처리
+            droppedCount += quint64(accumulatorNs / stepNs);
+            accumulatorNs %= stepNs;
+            break;
+        }
+        accumulatorNs -= stepNs;
+        ++steps;
+        emit step();
+    }
+    recordFrame(frameNs, steps);
+
+    if (active)
+        emit frame(qreal(accumulatorNs) / qreal(stepNs));
+    recordAllocations(AllocationCounter::threadCount() - allocationsBefore);
+}
+
+void FrameScheduler::recordFrame(qint64 frameNs, int steps)
+{
+    const qint64 us = frameNs / 1000;
+    int bucket = 0;
+    while (bucket < FrameStats::FRAME_BUCKETS - 1 && us >= frameBucketEdgesUs[bucket])
+        ++bucket;
+    ++frameHistogram[bucket];
+    ++stepHistogram[qMin(steps, FrameStats::STEP_BUCKETS - 1)];
+    ++frameCount;
+    stepCount += quint64(steps);
+    frameSumNs += frameNs;
+    lastFrameNs = frameNs;
+    if (frameNs > maxFrameNs)
+        maxFrameNs = frameNs;
+}
+
+void FrameScheduler::recordAllocations(quint64 allocations)
+{
+    lastTickAllocations = allocations;
+    if (allocations > maxTickAllocations)
+        maxTickAllocations = allocations;
+    if (allocations)
+        ++allocatingTicks;
+}
+
+void FrameScheduler::resetStats()
+{
+    frameCount = 0;
+    stepCount = 0;
+    droppedCount = 0;
+    frameSumNs = 0;
+    lastFrameNs = 0;
+    maxFrameNs = 0;
+    lastTickAllocations = 0;
+    maxTickAllocations = 0;
+    allocatingTicks = 0;
+    for (int i = 0; i < FrameStats::FRAME_BUCKETS; ++i)
+        frameHistogram[i] = 0;
+    for (int i = 0; i < FrameStats::STEP_BUCKETS; ++i)
+        stepHistogram[i] = 0;
+}
+
+FrameStats FrameScheduler::stats() const
+{
+    FrameStats s;
+    s.vsync = vsync;
+    s.stepHz = stepHz;
+    s.frames = frameCount;
+    s.steps = stepCount;
+    s.droppedSteps = droppedCount;
+    for (int i = 0; i < FrameStats::FRAME_BUCKETS; ++i)
+        s.frameHistogram[i] = frameHistogram[i];
+    for (int i = 0; i < FrameStats::STEP_BUCKETS; ++i)
+        s.stepHistogram[i] = stepHistogram[i];
+    s.lastFrameMs = lastFrameNs / 1.0e6;
+    s.avgFrameMs = frameCount ? frameSumNs / 1.0e6 / frameCount : 0.0;
+    s.maxFrameMs = maxFrameNs / 1.0e6;
+    s.lastTickAllocations = lastTickAllocations;
+    s.maxTickAllocations = maxTickAllocations;
+    s.allocatingTicks = allocatingTicks;
+    return s;
+}
+
+QStringList FrameScheduler::statsLines() const
+{
+    const FrameStats s = stats();
+    QStringList lines;
+    lines << QString("Frame: %1 step %2Hz, frames %3 steps %4 dropped %5")
+             .arg(s.vsync ? "vsync" : "timer").arg(s.stepHz).arg(s.frames).arg(s.steps).arg(s.droppedSteps);
+    lines << QString("Frame ms: last %1 avg %2 max %3")
+             .arg(s.lastFrameMs, 0, 'f', 1).arg(s.avgFrameMs, 0, 'f', 1).arg(s.maxFrameMs, 0, 'f', 1);
+    QString histogram = "Frame hist:";
+    for (int i = 0; i < FrameStats::FRAME_BUCKETS; ++i) {
+        if (s.frameHistogram[i])
+            histogram += QString(" %1:%2").arg(frameBucketLabels[i]).arg(s.frameHistogram[i]);
+    }
+    lines << histogram;
+    QString stepHistogram = "Steps/frame:";
+    for (int i = 0; i < FrameStats::STEP_BUCKETS; ++i) {
+        if (s.stepHistogram[i])
+            stepHistogram += QString(" %1%2:%3").arg(i).arg(i == FrameStats::STEP_BUCKETS - 1 ? "+" : "").arg(s.stepHistogram[i]);
+    }
+    lines << stepHistogram;
+    if (AllocationCounter::isEnabled()) {
+        lines << QString("Heap allocs/tick: last %1 max %2, ticks with allocs %3")
+                 .arg(s.lastTickAllocations).arg(s.maxTickAllocations).arg(s.allocatingTicks);
+    }
+    return lines;
+}
+
+void FrameScheduler::dumpStats() const
+{
+    for (const QString &line : statsLines())
+        qDebug().noquote() << line;
+}
@@ -0,0 +1,97 @@
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QStringList>
+
+// 프레임 계측값 스냅샷 (오버레이/로그 출력용)
+struct FrameStats {
+    static const int FRAME_BUCKETS = 8;  // <8, 8-12, 12-16, 16-20, 20-25, 25-33, 33-50, >=50ms
+    static const int STEP_BUCKETS = 6;   // 프레임당 시뮬레이션 스텝 0, 1, 2, 3, 4, 5 이상
+
+    bool vsync;              // 디스플레이 스왑 신호로 구동 중인지
+    int stepHz;
+    quint64 frames;
+    quint64 steps;
+    quint64 droppedSteps;    // 한 프레임 최대 스텝 수를 넘어 버린 스텝
+    quint64 frameHistogram[FRAME_BUCKETS];
+    quint64 stepHistogram[STEP_BUCKETS];
+    double lastFrameMs;
+    double avgFrameMs;
+    double maxFrameMs;
+    // 틱(스텝 + 렌더링 준비) 중 GUI 스레드의 힙 할당 (ALLOCATION_COUNTER 빌드만, 정상 상태면 0)
+    quint64 lastTickAllocations;
+    quint64 maxTickAllocations;
+    quint64 allocatingTicks;    // 할당이 한 번이라도 있었던 틱 수
+};
+
+// 고정 시간 간격 시뮬레이션 + 보간 렌더링 스케줄러
+// 틱마다 실제 경과 시간을 누산기에 더하고 고정 간격(1/stepHz)만큼 step()을 반복한 뒤
+// 남은 비율(0~1)을 frame()으로 알려 렌더러가 이전/현재 스텝 사이를 보간하도록 함
+// 틱은 Qt::PreciseTimer 또는 디스플레이 스왑 신호(vsync, GL 백엔드)로 구동
+class FrameScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FrameScheduler(int stepHz = 60, QObject *parent = nullptr);
+
+    void start();
+    void stop();
+    bool isActive() const { return active; }
+
+    // true면 외부 스왑 신호가 tick()을 호출하고 타이머는 신호가 끊겼을 때만 깨움
+    void setVsyncDriven(bool enabled);
+    // 타이머 구동 시 틱 간격 (화면 주사율 기준)
+    void setTickInterval(int ms);
+
+    double stepMs() const { return stepNs / 1.0e6; }
+
+    FrameStats stats() const;
+    QStringList statsLines() const;
+    void dumpStats() const;
+    void resetStats();
+
+public slots:
+    void tick();
+
+signals:
+    void step();                // 고정 간격 시뮬레이션 한 스텝
+    void frame(qreal alpha);    // 렌더링 (alpha: 마지막 스텝 이후 경과 비율)
+
+private slots:
+    void onTimer();
+
+private:
+    static const int MAX_STEPS_PER_FRAME = 5;  // 멈춘 뒤 따라잡기 폭주 방지
+    static const int VSYNC_WATCHDOG_MS = 50;   // 스왑 신호가 끊겼을 때 다시 깨우는 간격
+
+    void recordFrame(qint64 frameNs, int steps);
+    void recordAllocations(quint64 allocations);
+
+    QTimer timer;
+    QElapsedTimer clock;
+    bool active;
+    bool vsync;
+    int tickInterval;
+    int stepHz;
+    qint64 stepNs;
+    qint64 lastTickNs;
+    qint64 accumulatorNs;
+
+    quint64 frameCount;
+    quint64 stepCount;
+    quint64 droppedCount;
+    quint64 frameHistogram[FrameStats::FRAME_BUCKETS];
+    quint64 stepHistogram[FrameStats::STEP_BUCKETS];
+    qint64 frameSumNs;
+    qint64 lastFrameNs;
+    qint64 maxFrameNs;
+    quint64 lastTickAllocations;
+    quint64 maxTickAllocations;
+    quint64 allocatingTicks;
+};
+
+#endif // FRAMESCHEDULER_H
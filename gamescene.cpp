@@ -0,0 +1,172 @@
+#include "gamescene.h"
+#include <algorithm>
+
+static inline bool sameItem(const GameScene::DrawItem &a, const GameScene::DrawItem &b)
+{
+    return a.sprite == b.sprite && a.target == b.target && a.source == b.source;
+}
+
+GameScene::SpriteMetrics::SpriteMetrics()
+    : starFrames(1)
+{
+    for (int i = 0; i < SpriteCount; ++i)
+        pixelRatio[i] = 1.0;
+}
+
+GameScene::GameScene()
+    : backgroundScroll(0)
+    , previousBackgroundScroll(0)
+{
+}
+
+QSize GameScene::logicalSize(SpriteId sprite) const
+{
+    const QSize &px = spriteMetrics.pixelSize[sprite];
+    const qreal ratio = spriteMetrics.pixelRatio[sprite];
+    return QSize(qRound(px.width() / ratio), qRound(px.height() / ratio));
+}
+
+void GameScene::begin(const QSize &size)
+{
+    viewSize = size;
+    previousBackgroundScroll = backgroundScroll;
+    drawItems.swap(previousItems);
+    drawItems.resize(0);
+}
+
+inline void GameScene::add(const QRect &target, const QRect &source, SpriteId sprite, Layer layer)
+{
+    DrawItem item;
+    item.target = target;
+    item.source = source;
+    item.sprite = sprite;
+    item.layer = layer;
+    drawItems.append(item);
+}
+
+// 몸통 타일을 타일 단위로 나눈 항목 + 캡 1개
+// 위쪽 장애물은 몸통 무늬가 캡 바로 위에서 끝나도록 첫 타일의 시작 위치를 맞춤
+void GameScene::addPillar(const QRect &obstacle, bool capAtBottom)
+{
+    const int h = obstacle.height();
+    if (h <= 0) return;
+
+    const QSize body = spriteMetrics.pixelSize[SpritePillarBody];
+    const SpriteId capSprite = capAtBottom ? SpriteTopCap : SpriteBottomCap;
+    const QSize cap = spriteMetrics.pixelSize[capSprite];
+    const int tileH = qMax(1, body.height());
+    const int capH = cap.isEmpty() ? 0 : qMin(cap.height(), h);
+    const int bodyH = h - capH;
+    const int x = obstacle.x() + (obstacle.width() - body.width()) / 2;
+    const int capX = x - (cap.width() - body.width()) / 2;
+
+    int y = capAtBottom ? obstacle.y() : obstacle.y() + capH;
+    int srcY = capAtBottom ? (tileH - bodyH % tileH) % tileH : 0;
+    int remaining = bodyH;
+    while (remaining > 0) {
+        const int segment = qMin(tileH - srcY, remaining);
+        add(QRect(x, y, body.width(), segment), QRect(0, srcY, body.width(), segment), SpritePillarBody, LayerPillars);
+        y += segment;
+        remaining -= segment;
+        srcY = 0;
+    }
+
+    if (capH > 0) {
+        if (capAtBottom)
+            add(QRect(capX, obstacle.y() + bodyH, cap.width(), capH), QRect(0, cap.height() - capH, cap.width(), capH), capSprite, LayerPillars);
+        else
+            add(QRect(capX, obstacle.y(), cap.width(), capH), QRect(0, 0, cap.width(), capH), capSprite, LayerPillars);
+    }
+}
+
+// 별 아틀라스 셀은 정사각형 (셀 크기 = 아틀라스 높이)
+void GameScene::addStar(const QPointF &center, int frame)
+{
+    const int cell = spriteMetrics.pixelSize[SpriteStar].height();
+    if (cell <= 0) return;
+    const int frames = qMax(1, spriteMetrics.starFrames);
+    const int f = ((frame % frames) + frames) % frames;
+    const int logical = qRound(cell / spriteMetrics.pixelRatio[SpriteStar]);
+    add(QRect(qRound(center.x() - logical / 2.0), qRound(center.y() - logical / 2.0), logical, logical),
+        QRect(f * cell, 0, cell, cell), SpriteStar, LayerStars);
+}
+
+// 플레이어 이미지는 충돌 박스 중앙에 맞춤
+void GameScene::addPlayer(const QRect &hitBox)
+{
+    const QSize image = logicalSize(SpritePlayer);
+    add(QRect(hitBox.x() + (hitBox.width() - image.width()) / 2, hitBox.y() + (hitBox.height() - image.height()) / 2,
+              image.width(), image.height()),
+        QRect(QPoint(0, 0), spriteMetrics.pixelSize[SpritePlayer]), SpritePlayer, LayerPlayers);
+}
+
+void GameScene::addRemotePlayer(const QRect &hitBox)
+{
+    add(hitBox, QRect(QPoint(0, 0), spriteMetrics.pixelSize[SpriteRemotePlayer]), SpriteRemotePlayer, LayerPlayers);
+}
+
+void GameScene::finish()
+{
+    std::stable_sort(drawItems.begin(), drawItems.end(), [](const DrawItem &a, const DrawItem &b) {
+        return a.layer != b.layer ? a.layer < b.layer : a.sprite < b.sprite;
+    });
+}
+
+namespace {
+// 세로로 이어지는 같은 x/너비의 사각형(기둥 타일 조각)을 하나로 합침
+struct RectMerger {
+    QVector<QRect> &out;
+    QRect pending;
+
+    explicit RectMerger(QVector<QRect> &rects) : out(rects) {}
+
+    void push(const QRect &r)
+    {
+        if (pending.isNull()) {
+            pending = r;
+        } else if (r.left() == pending.left() && r.width() == pending.width()
+                   && r.top() <= pending.bottom() + 1 && r.bottom() >= pending.top() - 1) {
+            pending = pending.united(r);
+        } else {
+            out.append(pending);
+            pending = r;
+        }
+    }
+    void flush()
+    {
+        if (!pending.isNull())
+            out.append(pending);
+        pending = QRect();
+    }
+};
+}
+
+// 같은 인덱스끼리 비교 (엔티티 순서가 유지되므로 대부분 이동한 항목만 잡힘)
+// 항목이 사라져 인덱스가 밀리면 더 넓게 잡힐 뿐 누락은 없음
+QRegion GameScene::damage() const
+{
+    if (backgroundScroll != previousBackgroundScroll)
+        return QRegion(QRect(QPoint(0, 0), viewSize));
+
+    QVector<QRect> &rects = damageRects;
+    rects.resize(0);
+    RectMerger oldRects(rects);
+    RectMerger newRects(rects);
+
+    const int count = qMax(drawItems.size(), previousItems.size());
+    for (int i = 0; i < count; ++i) {
+        const bool hasNew = i < drawItems.size();
+        const bool hasOld = i < previousItems.size();
+        if (hasNew && hasOld && sameItem(drawItems[i], previousItems[i]))
+            continue;
+        if (hasOld) oldRects.push(previousItems[i].target);
+        if (hasNew) newRects.push(drawItems[i].target);
+    }
+    oldRects.flush();
+    newRects.flush();
+
+    QRegion region;
+    for (const QRect &r : rects)
+        region += r;
+    return region;
+}
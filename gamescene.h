@@ -0,0 +1,84 @@
+#ifndef GAMESCENE_H
+#define GAMESCENE_H
+
+#include <QVector>
+#include <QRect>
+#include <QPointF>
+#include <QSize>
+#include <QRegion>
+
+// 유지형(retained) 장면: 한 프레임에 그릴 스프라이트를 평탄한 배열로 보관
+// updateGame이 게임 상태로부터 만들고, 렌더러(래스터/OpenGL)는 이 배열만 읽음
+// 위젯/픽스맵에 의존하지 않으므로 창 없이도 만들고 측정할 수 있음
+class GameScene
+{
+public:
+    enum SpriteId : quint8 {
+        SpritePillarBody,   // 세로로 반복되는 기둥 몸통 타일
+        SpriteTopCap,       // 위쪽 장애물 끝 (아래에 붙음)
+        SpriteBottomCap,    // 아래쪽 장애물 끝 (위에 붙음)
+        SpriteStar,         // 별 아틀라스 (가로로 애니메이션 프레임)
+        SpritePlayer,
+        SpriteRemotePlayer,
+        SpriteCount
+    };
+    // 그리는 순서 (작은 값이 먼저)
+    enum Layer : quint8 {
+        LayerStars,
+        LayerPillars,
+        LayerPlayers
+    };
+
+    struct DrawItem {
+        QRect target;       // 화면 좌표 (논리 픽셀)
+        QRect source;       // 스프라이트 이미지 내부 원본 영역 (실제 픽셀)
+        quint8 sprite;      // SpriteId
+        quint8 layer;       // Layer
+    };
+
+    // 스프라이트 이미지 크기 (에셋 준비 시 한 번 설정)
+    struct SpriteMetrics {
+        QSize pixelSize[SpriteCount];
+        qreal pixelRatio[SpriteCount];  // 실제 픽셀 / 논리 픽셀
+        int starFrames;
+
+        SpriteMetrics();
+    };
+
+    GameScene();
+
+    void setMetrics(const SpriteMetrics &metrics) { spriteMetrics = metrics; }
+    const SpriteMetrics &metrics() const { return spriteMetrics; }
+
+    // 새 프레임 시작 - 이전 프레임 배열은 변경 영역 계산용으로 보관 (용량 재사용, 재할당 없음)
+    void begin(const QSize &viewSize);
+    // 배경 이미지에서 화면 왼쪽 끝에 오는 x 위치 (패럴랙스 스크롤, 배경 이미지 픽셀 단위)
+    void setBackgroundOffset(int offset) { backgroundScroll = offset; }
+    int backgroundOffset() const { return backgroundScroll; }
+    void addPillar(const QRect &obstacle, bool capAtBottom);
+    void addStar(const QPointF &center, int frame);
+    void addPlayer(const QRect &hitBox);
+    void addRemotePlayer(const QRect &hitBox);
+    // 레이어 → 텍스처(스프라이트) 순으로 정렬 (같은 키는 추가 순서 유지)
+    void finish();
+
+    const QVector<DrawItem> &items() const { return drawItems; }
+    QSize size() const { return viewSize; }
+
+    // 이전 프레임과 달라진 항목의 이전/현재 영역 합집합 (배경이 스크롤됐으면 화면 전체)
+    QRegion damage() const;
+
+private:
+    void add(const QRect &target, const QRect &source, SpriteId sprite, Layer layer);
+    QSize logicalSize(SpriteId sprite) const;
+
+    SpriteMetrics spriteMetrics;
+    QSize viewSize;
+    int backgroundScroll;
+    int previousBackgroundScroll;
+    QVector<DrawItem> drawItems;
+    QVector<DrawItem> previousItems;
+    mutable QVector<QRect> damageRects;     // damage() 작업 버퍼 (용량 유지, 프레임마다 재사용)
+};
+
+#endif // GAMESCENE_H
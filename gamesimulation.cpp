@@ -0,0 +1,329 @@
+#include "gamesimulation.h"
+
+GameSimulation::GameSimulation()
+    : collider(nullptr)
+    , target(0)
+    , points(0)
+    , over(false)
+    , steps(0)
+    , stepsSinceSpawn(0)
+    , pitchSamples(0)
+    , pitchHits(0)
+{
+    reset(Config());
+}
+
+void GameSimulation::reset(const Config &config)
+{
+    settings = config;
+    playerBox = QRect(PLAYER_X, config.height / 2 - PLAYER_SIZE / 2, PLAYER_SIZE, PLAYER_SIZE);
+    target = playerBox.y();
+    points = 0;
+    over = false;
+    steps = 0;
+    stepsSinceSpawn = 0;
+    obstacleStore.clear();
+    starStore.clear();
+    pairNotes.clear();
+    pitchSamples = 0;
+    pitchHits = 0;
+    difficultyEngine.reset(config.difficulty ? *config.difficulty : DifficultyEngine::defaultProfile(), STEP_HZ);
+    setLevel(config.seed);
+}
+
+void GameSimulation::setLevel(quint32 seed, int pieceIndex)
+{
+    settings.seed = seed;
+    LevelGenerator::Config level;
+    level.height = settings.height;
+    level.seed = seed;
+    level.playerSize = PLAYER_SIZE;
+    // 이웃한 쌍 사이 빈 구간(장애물/플레이어 너비를 뺀 간격)을 지나는 동안 움직일 수 있는 거리
+    // 속도/간격은 플레이 중 바뀌므로 프로파일에서 가장 빡빡한 경우 기준
+    level.travel = difficultyEngine.minTravelSteps(OBSTACLE_WIDTH + PLAYER_SIZE) * PLAYER_SPEED;
+    level.starChance = STAR_CHANCE;
+    // 틈 크기는 생성 시점의 난이도가 정하므로 레벨은 가장 좁은 틈 기준으로 배치 (도달 거리 계산이 보수적)
+    level.startGap = difficultyEngine.currentProfile().minGap;
+    level.minGap = difficultyEngine.currentProfile().minGap;
+    level.gapShrink = 0;
+    level.mode = settings.levelMode;
+    level.scale = settings.scale;
+    level.maxInterval = settings.maxInterval;
+    level.melody = settings.melody;
+    level.noteToY = &GameSimulation::targetYForPitch;   // 마이크 피치로 움직일 때와 같은 변환
+    levelGenerator.reset(level);
+    if (pieceIndex > 0)
+        levelGenerator.seek(pieceIndex);
+}
+
+SimEvents GameSimulation::step(const SimInput &input)
+{
+    SimEvents events;
+    if (over) return events;
+    ++steps;
+    const int previousY = playerBox.y();
+    difficultyEngine.update(points, steps);
+    const int scroll = difficultyEngine.advance();
+
+    // 마이크 입력: 목표 높이로 스텝당 최대 PLAYER_SPEED만큼 이동
+    if (input.voiced) {
+        if (input.pitchScore > 0)
+            target = targetYForPitch(input.pitchScore, settings.height);
+        const int dy = target - playerBox.y();
+        if (dy != 0)
+            playerBox.translate(0, qBound(-PLAYER_SPEED, dy, int(PLAYER_SPEED)));
+    }
+
+    // 키보드 입력 (가장자리 근처에서 한 스텝 이동 거리만큼 넘어가지 않도록 고정)
+    const int maxY = qMax(0, settings.height - PLAYER_SIZE);
+    if (input.up && playerBox.y() > 0)
+        playerBox.moveTop(qMax(0, playerBox.y() - PLAYER_SPEED));
+    if (input.down && playerBox.y() < maxY)
+        playerBox.moveTop(qMin(maxY, playerBox.y() + PLAYER_SPEED));
+
+    // 장애물 이동 및 제거 (모두 같은 속도이므로 화면을 벗어난 장애물은 항상 앞쪽에 모여 있음)
+    const int leftBoundary = 0;
+    obstacleStore.translate(-scroll);
+    events.obstaclesPassed = obstacleStore.cullLeft(leftBoundary);
+    points += events.obstaclesPassed;
+    for (int i = 0; i < events.obstaclesPassed / 2 && !pairNotes.isEmpty(); ++i)
+        pairNotes.removeFirst();
+
+    // 음 정확도: 플레이어가 음이 있는 틈 안을 지나는 스텝마다 부른 음과 비교
+    const int first = obstacleStore.firstEndingAfter(playerBox.left());
+    if (first < obstacleStore.size() && first / 2 < pairNotes.size()
+        && obstacleStore.rect(first).left() <= playerBox.right()) {
+        const int note = pairNotes[first / 2];
+        if (note > 0) {
+            ++pitchSamples;
+            if (input.voiced && qAbs(input.pitchScore - note) <= PITCH_TOLERANCE)
+                ++pitchHits;
+        }
+    }
+
+    // 별 이동 및 획득 검사 (히트박스 주변 여유, 플레이어 x 구간에 걸친 별만 검사)
+    // 획득 범위는 이번 스텝 동안 별에 대해 상대적으로 지나간 구간 전체 (속도가 빨라도 건너뛰지 않게)
+    starStore.translate(-scroll);
+    starStore.cullLeft(leftBoundary);
+    const QRect pickupBox = playerBox.adjusted(-STAR_PICKUP_MARGIN, -STAR_PICKUP_MARGIN, STAR_PICKUP_MARGIN, STAR_PICKUP_MARGIN);
+    const QRect pickup = pickupBox.united(pickupBox.translated(scroll, previousY - playerBox.y()));
+    int starHits[STAR_CAPACITY];
+    events.starsCollected = starStore.overlaps(pickup, starHits, STAR_CAPACITY);
+    for (int i = 0; i < events.starsCollected; ++i)
+        starStore.kill(starHits[i]);
+    points += events.starsCollected * STAR_SCORE;
+
+    if (checkCollision(scroll, previousY)) {
+        events.collided = true;
+        over = true;
+        return events;
+    }
+
+    // 장애물 생성은 벽시계 타이머 대신 스텝 수로 (보드마다 같은 스텝에 생성)
+    if (settings.spawning && ++stepsSinceSpawn >= difficultyEngine.spawnInterval()) {
+        stepsSinceSpawn = 0;
+        events.spawned = spawnObstacles();
+    }
+    return events;
+}
+
+bool GameSimulation::spawnObstacles()
+{
+    // 가득 차면 이번 쌍은 건너뜀 (플레이 중 재할당 없음, 레벨 순서는 그대로 진행)
+    const LevelPiece piece = levelGenerator.next();
+    if (obstacleStore.size() + 2 > OBSTACLE_CAPACITY)
+        return false;
+
+    // 틈 크기는 지금 난이도 기준 (레벨의 틈 중앙에 맞춤, 작은 화면에서도 위/아래 장애물이 남도록)
+    const int x = settings.width;
+    const int gapSize = qMin(difficultyEngine.gapSize(), qMax(int(PLAYER_SIZE), settings.height - 2 * PLAYER_SIZE));
+    const int gapTop = qBound(0, piece.gapCenter - gapSize / 2, settings.height - gapSize);
+    const int gapBottom = gapTop + gapSize;
+    obstacleStore.append(QRect(x, 0, OBSTACLE_WIDTH, gapTop), ObstacleStore::TopObstacle);
+    obstacleStore.append(QRect(x, gapBottom, OBSTACLE_WIDTH, settings.height - gapBottom));
+    pairNotes.append(piece.note);
+
+    // 별은 틈 중앙에 (가득 차 있으면 생략)
+    if (piece.star) {
+        const int starX = x + OBSTACLE_WIDTH / 2;
+        starStore.append(QRect(starX - STAR_SIZE / 2, piece.gapCenter - STAR_SIZE / 2, STAR_SIZE, STAR_SIZE));
+    }
+    return true;
+}
+
+// 상대 이동 구간에서 [a0, a0 + length)가 [b0, b1)과 겹치는 t 범위 (분수, 분모 > 0)
+struct SweepFraction {
+    qint64 num;
+    qint64 den;
+    bool operator<(const SweepFraction &other) const { return num * other.den < other.num * den; }
+};
+
+static bool sweepAxis(int a0, int length, int move, int b0, int b1, SweepFraction &enter, SweepFraction &exit)
+{
+    if (move == 0) {
+        enter = { 0, 1 };
+        exit = { 1, 1 };
+        return a0 < b1 && a0 + length > b0;
+    }
+    if (move > 0) {
+        enter = { b0 - (a0 + length), move };
+        exit = { b1 - a0, move };
+    } else {
+        enter = { a0 - b1, -move };
+        exit = { a0 + length - b0, -move };
+    }
+    return true;
+}
+
+// 히트박스가 start에서 end로 직선 이동하는 동안 obstacle과 겹치는 순간이 있는지 (정수 분수 비교, 정확)
+static bool sweptIntersects(const QRect &start, const QRect &end, const QRect &obstacle)
+{
+    SweepFraction enterX, exitX, enterY, exitY;
+    if (!sweepAxis(start.x(), start.width(), end.x() - start.x(), obstacle.left(), obstacle.left() + obstacle.width(), enterX, exitX)
+        || !sweepAxis(start.y(), start.height(), end.y() - start.y(), obstacle.top(), obstacle.top() + obstacle.height(), enterY, exitY))
+        return false;
+    SweepFraction enter = { 0, 1 };
+    SweepFraction exit = { 1, 1 };
+    if (enter < enterX) enter = enterX;
+    if (enter < enterY) enter = enterY;
+    if (exitX < exit) exit = exitX;
+    if (exitY < exit) exit = exitY;
+    return enter < exit;
+}
+
+bool GameSimulation::checkCollision(int scroll, int previousY) const
+{
+    // 장애물 기준 좌표에서 플레이어는 (scroll, previousY)만큼 떨어진 곳에서 지금 위치로 직선 이동
+    // 광역 단계도 이동 경로 전체를 덮는 상자로 질의 → 속도가 히트박스+장애물 너비를 넘어도 건너뛰지 않음
+    const QRect start = playerBox.translated(scroll, previousY - playerBox.y());
+    const QRect swept = start.united(playerBox);
+    int candidates[8];
+
+    if (!collider) {
+        const int count = obstacleStore.overlaps(swept, candidates, 8);
+        for (int i = 0; i < count; ++i) {
+            if (sweptIntersects(start, playerBox, obstacleStore.rect(candidates[i])))
+                return true;
+        }
+        return false;
+    }
+
+    // 정밀 판정은 마스크라 분수 계산 대신 경로를 SWEEP_SAMPLE 간격으로 나눠 검사 (시작 위치는 지난 스텝에서 검사함)
+    const int distance = qMax(qAbs(scroll), qAbs(playerBox.y() - previousY));
+    const int samples = qMax(1, (distance + SWEEP_SAMPLE - 1) / SWEEP_SAMPLE);
+    const int count = obstacleStore.overlaps(collider->queryRect(swept), candidates, 8);
+    for (int i = 0; i < count; ++i) {
+        const int index = candidates[i];
+        const QRect obstacle = obstacleStore.rect(index);
+        const bool top = obstacleStore.hasFlag(index, ObstacleStore::TopObstacle);
+        for (int k = samples; k >= 1; --k) {
+            const int back = samples - k;
+            const QRect hitBox = playerBox.translated(scroll * back / samples, (previousY - playerBox.y()) * back / samples);
+            if (collider->collides(obstacle, top, hitBox))
+                return true;
+        }
+    }
+    return false;
+}
+
+int GameSimulation::upcomingGapPitch() const
+{
+    // 장애물은 위/아래 쌍으로 생성 순서대로 저장됨, 플레이어를 지난 장애물은 광역 단계 시작 인덱스로 건너뜀
+    for (int i = obstacleStore.firstEndingAfter(playerBox.left()); i + 1 < obstacleStore.size(); ++i) {
+        if (!obstacleStore.isAlive(i) || !obstacleStore.hasFlag(i, ObstacleStore::TopObstacle)) continue;
+        const QRect obstacle = obstacleStore.rect(i);
+        if (obstacle.right() < playerBox.left()) continue;
+        if (i / 2 < pairNotes.size() && pairNotes[i / 2] > 0)
+            return pairNotes[i / 2];
+        const int gapCenter = (obstacle.y() + obstacle.height() + obstacleStore.rect(i + 1).y()) / 2;
+        return pitchScoreForY(gapCenter - PLAYER_SIZE / 2, settings.height);
+    }
+    return 0;
+}
+
+QVector<SongNote> GameSimulation::pitchTrack(int count) const
+{
+    // 첫 쌍 생성 스텝부터 난이도 엔진을 시간만으로 돌려 각 쌍이 플레이어 앞에 도착하는 스텝을 구함
+    const QVector<LevelPiece> pieces = levelGenerator.song(count);
+    QVector<SongNote> track;
+    track.reserve(pieces.size());
+    DifficultyEngine timing;
+    timing.reset(difficultyEngine.currentProfile(), STEP_HZ);
+    QVector<int> inFlight;      // 아직 도착하지 않은 쌍의 x
+    int spawned = 0;
+    int sinceSpawn = 0;
+    const int arrivalX = PLAYER_X + PLAYER_SIZE;
+    for (int step = 0; track.size() < pieces.size(); ++step) {
+        if (step > 0) {
+            timing.update(0, quint64(step));
+            const int scroll = timing.advance();
+            for (int &x : inFlight)
+                x -= scroll;
+            while (!inFlight.isEmpty() && inFlight.first() <= arrivalX) {
+                SongNote note;
+                note.step = step;
+                note.note = pieces[track.size()].note;
+                track.append(note);
+                inFlight.removeFirst();
+            }
+        }
+        if (spawned < pieces.size() && (step == 0 || ++sinceSpawn >= timing.spawnInterval())) {
+            sinceSpawn = 0;
+            inFlight.append(settings.width);
+            ++spawned;
+        }
+    }
+    return track;
+}
+
+// FNV-1a (플레이어, 점수, 스텝 수, 레벨 진행, 살아 있는 장애물/별)
+quint32 GameSimulation::stateHash() const
+{
+    quint32 hash = 2166136261u;
+    auto mix = [&hash](qint64 value) {
+        for (int i = 0; i < 8; ++i) {
+            hash ^= quint32(value >> (i * 8)) & 0xFF;
+            hash *= 16777619u;
+        }
+    };
+    mix(playerBox.y());
+    mix(target);
+    mix(points);
+    mix(qint64(steps));
+    mix(over);
+    mix(levelGenerator.index());
+    mix(pitchHits);
+    mix(difficultyEngine.speed());
+    for (int i = 0; i < obstacleStore.size(); ++i) {
+        if (!obstacleStore.isAlive(i)) continue;
+        const QRect r = obstacleStore.rect(i);
+        mix(r.x());
+        mix(r.y());
+        mix(r.height());
+    }
+    for (int i = 0; i < starStore.size(); ++i) {
+        if (!starStore.isAlive(i)) continue;
+        const QRect r = starStore.rect(i);
+        mix(r.x());
+        mix(r.y());
+    }
+    return hash;
+}
+
+// 점수 1은 맨 아래, 37은 맨 위 (내림, 이전 float 계산과 경계값 오차 외에는 같은 결과)
+int GameSimulation::targetYForPitch(int pitchScore, int height)
+{
+    const int range = height - PLAYER_SIZE;
+    if (range <= 0) return 0;
+    return qBound(0, (37 - pitchScore) * range / 36, range);
+}
+
+// targetYForPitch의 역변환 (가장 가까운 점수로 반올림)
+int GameSimulation::pitchScoreForY(int y, int height)
+{
+    const int range = height - PLAYER_SIZE;
+    if (range <= 0) return 1;
+    const int scaled = 36 * (range - y);
+    if (scaled <= 0) return 1;
+    return qBound(1, 1 + (2 * scaled + range) / (2 * range), 37);
+}
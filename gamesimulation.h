@@ -0,0 +1,153 @@
+#ifndef GAMESIMULATION_H
+#define GAMESIMULATION_H
+
+#include <QRect>
+#include <QVector>
+#include <QtGlobal>
+#include "difficultyengine.h"
+#include "entitystore.h"
+#include "levelgenerator.h"
+#include "ringbuffer.h"
+
+// 한 스텝 입력 (마이크 피치 + 키보드)
+struct SimInput {
+    int pitchScore;     // 1~37, 0이면 피치 없음
+    bool voiced;        // 볼륨이 임계값 이상 (피치 목표로 이동)
+    bool up;
+    bool down;
+
+    SimInput() : pitchScore(0), voiced(false), up(false), down(false) {}
+};
+
+// 한 스텝 동안 일어난 일 (소리/네트워크 등 부수 효과는 호출하는 쪽이 처리)
+struct SimEvents {
+    int obstaclesPassed;
+    int starsCollected;
+    bool spawned;
+    bool collided;
+
+    SimEvents() : obstaclesPassed(0), starsCollected(0), spawned(false), collided(false) {}
+};
+
+// 음 모드 레벨의 한 음 (플레이어가 그 틈에 도착하는 스텝, 첫 쌍 생성 스텝 기준)
+struct SongNote {
+    int step;
+    int note;
+};
+
+// 게임 규칙 (위젯/타이머/부동소수점과 무관한 결정적 시뮬레이션)
+// 좌표는 월드 정수 좌표(1 = 1픽셀), 시간은 스텝 수(STEP_HZ), 난수는 시드에서만 나옴
+// 스크롤 속도/생성 간격/틈 크기는 난이도 엔진이 스텝마다 점수와 경과 시간으로 정함
+// → 같은 설정과 같은 입력 순서면 어느 보드에서나 같은 상태 (stateHash로 비교)
+// GameWindow, 헤드리스 실행기, 벤치마크가 같은 코드를 사용
+class GameSimulation
+{
+public:
+    static const int STEP_HZ = 60;
+    static const int PLAYER_X = 50;
+    static const int PLAYER_SIZE = 30;        // 히트박스 (그려지는 스프라이트는 더 큼)
+    static const int PLAYER_SPEED = 5;        // 스텝당 최대 이동 거리
+    static const int OBSTACLE_WIDTH = 40;
+    static const int STAR_SIZE = 60;
+    static const int STAR_PICKUP_MARGIN = 15; // 별 획득 판정 여유 (히트박스 둘레)
+    static const int STAR_CHANCE = 30;        // 장애물 쌍마다 별이 생길 확률 (%)
+    static const int STAR_SCORE = 3;
+    static const int PITCH_TOLERANCE = 1;     // 음 정확도: 틈의 음에서 반음 이만큼까지 맞은 것으로
+    static const int SWEEP_SAMPLE = 8;        // 정밀 판정 스윕 샘플 간격 (픽셀, 히트박스보다 충분히 작게)
+    static const int OBSTACLE_CAPACITY = 64;  // 화면에 동시에 있는 장애물 (쌍당 2개)
+    static const int STAR_CAPACITY = 32;
+    static const quint32 DEFAULT_SEED = 0xDEADBEEF;
+
+    // 장애물/별은 오른쪽에서 생성되어 왼쪽으로 사라지므로 FIFO (앞에서 O(1) 만료, 재할당 없음)
+    typedef EntityStore<OBSTACLE_CAPACITY> ObstacleStore;  // 위쪽 장애물은 TopObstacle 플래그
+    typedef EntityStore<STAR_CAPACITY> StarStore;          // 별 중심 기준 STAR_SIZE 정사각형
+
+    struct Config {
+        int width;
+        int height;
+        quint32 seed;
+        bool spawning;      // 멀티플레이어는 게임 시작 시점부터 true
+        LevelGenerator::Mode levelMode;
+        LevelGenerator::Scale scale;
+        int maxInterval;    // ScaleWalk 최대 음계 간격
+        int melody;         // Melody 멜로디 번호
+        const DifficultyEngine::Profile *difficulty;   // 보드 프로파일 (없으면 기본)
+
+        Config()
+            : width(1920), height(1080), seed(DEFAULT_SEED), spawning(true)
+            , levelMode(LevelGenerator::RandomGaps), scale(LevelGenerator::Major), maxInterval(2), melody(0)
+            , difficulty(nullptr) {}
+    };
+
+    // 정밀 충돌 판정 (설정하지 않으면 히트박스 AABB)
+    // 게임은 스프라이트 마스크로 판정하고, 헤드리스 실행은 기본값을 씀
+    class Collider
+    {
+    public:
+        virtual ~Collider() {}
+        // 광역 단계 질의 범위 (그려지는 스프라이트/기둥이 히트박스보다 넓은 만큼)
+        virtual QRect queryRect(const QRect &hitBox) const = 0;
+        virtual bool collides(const QRect &obstacle, bool topObstacle, const QRect &hitBox) const = 0;
+    };
+
+    GameSimulation();
+
+    void reset(const Config &config);
+    void setCollider(const Collider *collider) { this->collider = collider; }
+    void setSpawning(bool enabled) { settings.spawning = enabled; }
+    // 레벨 시드 교체 (멀티플레이어 클라이언트가 호스트 시드로 같은 레벨을 재생성, pieceIndex번째 쌍부터)
+    void setLevel(quint32 seed, int pieceIndex = 0);
+
+    SimEvents step(const SimInput &input);
+    bool spawnObstacles();     // 레벨의 다음 쌍을 즉시 생성 (가득 차 있으면 false)
+    // 이번 스텝 동안의 충돌 (장애물이 scroll만큼, 플레이어가 previousY에서 지금 위치로 움직인 경로 전체)
+    bool checkCollision(int scroll, int previousY) const;
+
+    const Config &config() const { return settings; }
+    const QRect &player() const { return playerBox; }
+    int targetY() const { return target; }
+    int score() const { return points; }
+    bool isOver() const { return over; }
+    quint64 stepCount() const { return steps; }
+    ObstacleStore &obstacles() { return obstacleStore; }
+    const ObstacleStore &obstacles() const { return obstacleStore; }
+    StarStore &stars() { return starStore; }
+    const StarStore &stars() const { return starStore; }
+    const LevelGenerator &level() const { return levelGenerator; }
+    const DifficultyEngine &difficulty() const { return difficultyEngine; }
+    int lastScroll() const { return difficultyEngine.lastScroll(); }   // 마지막 스텝의 장애물/별 이동 거리
+
+    // 음 모드: 틈 안을 지나는 동안 틈의 음과 맞게 부른 스텝 비율 (%), 표본 없으면 -1
+    int pitchAccuracy() const { return pitchSamples ? int(quint64(pitchHits) * 100 / pitchSamples) : -1; }
+    // 처음 count쌍의 음과 도착 스텝 (미리 계산한 피치 트랙, RandomGaps면 음이 0)
+    // 도착 스텝은 시간에 따른 난이도만 반영 (점수에 따른 가속은 플레이 결과라 제외)
+    QVector<SongNote> pitchTrack(int count) const;
+
+    // 플레이어 앞의 첫 틈의 음 (음 모드가 아니면 틈 중앙에 맞는 피치 점수, 없으면 0, 기준음 모드용)
+    int upcomingGapPitch() const;
+    // 상태 요약 해시 (lockstep/리플레이에서 보드 간 결과 비교용)
+    quint32 stateHash() const;
+
+    // 피치 점수(1~37) ↔ 플레이어 y (37이 맨 위), 정수 연산만 사용
+    static int targetYForPitch(int pitchScore, int height);
+    static int pitchScoreForY(int y, int height);
+
+private:
+    Config settings;
+    const Collider *collider;
+    DifficultyEngine difficultyEngine;
+    LevelGenerator levelGenerator;
+    QRect playerBox;
+    int target;
+    int points;
+    bool over;
+    quint64 steps;
+    int stepsSinceSpawn;
+    ObstacleStore obstacleStore;
+    StarStore starStore;
+    RingBuffer<int, OBSTACLE_CAPACITY / 2> pairNotes;  // 화면에 있는 장애물 쌍의 음 (생성 순서)
+    quint32 pitchSamples;
+    quint32 pitchHits;
+};
+
+#endif // GAMESIMULATION_H
@@ -1,4 +1,9 @@
 #include "gamewindow.h"
+#include "allocationcounter.h"
+#include "audioengine.h"
+#ifdef GAME_GL_BACKEND
+#include "glgameview.h"
+#endif
 #include <QMessageBox>
 #include <QPainter>
 #include <QRandomGenerator>
@@ -9,6 +14,8 @@
 #include <QFile>
 #include <QTextStream>
 #include <cmath>
+#include <QtMath>
+#include <QElapsedTimer>
 
 #include <QVector>  // QVector 추가
 #include <QDir>     // QDir 추가
@@ -22,17 +29,15 @@
 
 GameWindow::GameWindow(QWidget *parent, bool isMultiplayer)
     : QMainWindow(parent)
-    , gameTimer(nullptr)
-    , obstacleTimer(nullptr)
+    , frameScheduler(nullptr)
     , pitchTimer(nullptr)
-    , micProcess(nullptr)
-    , soundProcess(nullptr)  // 사운드 프로세스 초기화
     , pitchFile(nullptr)
     , backButton(nullptr)
     , udpSocket(nullptr)
     , broadcastTimer(nullptr)
     , cleanupTimer(nullptr)
     , countdownTimer(nullptr)
+    , glView(nullptr)
     , playerId(QString::number(QDateTime::currentMSecsSinceEpoch()))
     , isMultiplayerMode(isMultiplayer)
     , isInLobby(false)
@@ -40,20 +45,60 @@ GameWindow::GameWindow(QWidget *parent, bool isMultiplayer)
     , isHost(false)
     , countdownValue(0)
     , lastGameStateUpdate(0)
-    , playerSpeed(5)
-    , score(0)
+    , starFrames(qMax(1, qEnvironmentVariableIntValue("STAR_FRAMES")))
+    , backgroundLoader(nullptr)
+    , parallaxEnabled(qEnvironmentVariableIntValue("PARALLAX") != 0)
+    , backgroundScroll(0)
+    , previousPlayerY(WINDOW_HEIGHT/2 - PLAYER_SIZE/2)
+    , renderAlpha(1.0)
     , gameRunning(false)
     , moveUp(false)
     , moveDown(false)
     , currentPitch(0)
     , currentVolume(0.0f)
-    , targetY(WINDOW_HEIGHT/2 - PLAYER_SIZE/2)
+    , hudScore(-1)
+    , hudPlayerCount(-1)
+    , hudCountdown(-1)
+    , hudPitch(-1)
+    , hudVolume(-1)
+#ifdef QT_DEBUG
+    , showStatsOverlay(true)
+#else
+    , showStatsOverlay(false)
+#endif
+    , lastPaintAllocations(0)
+    , maxPaintAllocations(0)
+    , referenceToneEnabled(qEnvironmentVariableIntValue("REFERENCE_TONE") != 0)
+    , referenceScore(0)
+    , partialRepaint(qEnvironmentVariable("PARTIAL_REPAINT", "1") != "0")
+    , paintedPixels(0)
+    , paintedFrames(0)
+    , lastPaintedPixels(0)
 {
     qDebug() << "GameWindow constructor called" << (isMultiplayer ? "(Multiplayer)" : "(Single Player)");
     
     // 초기화 과정에서 창이 보이지 않도록 숨김
     hide();
     
+    initHudLabels();
+    remoteClock.start();
+    
+    // 전송 대상 주소/ID는 한 번만 만들어 두고 보낼 때마다 재사용
+    playerIdUtf8 = playerId.toUtf8();
+    for (int i = 3; i <= 8; ++i)
+        peerAddresses.append(QHostAddress(QString("192.168.10.%1").arg(i)));
+    
+    // 내부 렌더 배율 (RENDER_SCALE=0.5 등, 기본 1.0) - RENDER_SCALE_AUTO=0이면 자동 조절 끔
+    bool scaleOk = false;
+    const qreal renderScale = qEnvironmentVariable("RENDER_SCALE").toDouble(&scaleOk);
+    renderScaler.configure(scaleOk ? renderScale : 1.0, qEnvironmentVariable("RENDER_SCALE_AUTO", "1") != "0");
+    
+    // 배경은 게임 시작 전에 작업 스레드에서 화면 크기/포맷으로 준비 (setupGame이 창을 화면 크기로 띄움)
+    backgroundLoader = new BackgroundLoader("/mnt/nfs/background.png", this);
+    connect(backgroundLoader, &BackgroundLoader::ready, this, &GameWindow::onBackgroundReady);
+    if (QScreen *screen = QApplication::primaryScreen())
+        backgroundLoader->request(screen->geometry().size(), BackgroundLoader::nativeFormat(screen), parallaxEnabled);
+    
     // 생성자에서 바로 초기화하지 않고 이벤트 루프가 시작된 후 초기화
     QTimer::singleShot(50, this, &GameWindow::setupGame);
 }
@@ -67,17 +112,11 @@ GameWindow::~GameWindow()
     gameRunning = false;
     
     // 타이머들 먼저 정지 및 정리
-    if (gameTimer) {
-        gameTimer->stop();
-        gameTimer->disconnect();
-        gameTimer->deleteLater();
-        gameTimer = nullptr;
-    }
-    if (obstacleTimer) {
-        obstacleTimer->stop();
-        obstacleTimer->disconnect();
-        obstacleTimer->deleteLater();
-        obstacleTimer = nullptr;
+    if (frameScheduler) {
+        frameScheduler->stop();
+        frameScheduler->disconnect();
+        frameScheduler->deleteLater();
+        frameScheduler = nullptr;
     }
     if (pitchTimer) {
         pitchTimer->stop();
@@ -107,16 +146,11 @@ GameWindow::~GameWindow()
     // 멀티플레이어 정리
     stopMultiplayer();
     
-    // 마이크 프로세스 정리
-    stopMicProcess();
+    // 기준음 정지
+    AudioEngine::instance()->stopReferenceTone();
     
-    // 사운드 프로세스 정리
-    if (soundProcess) {
-        soundProcess->terminate();
-        soundProcess->waitForFinished(1000);
-        soundProcess->deleteLater();
-        soundProcess = nullptr;
-    }
+    // 마이크 프로세스 정리 (종료를 기다리지 않음)
+    AudioEngine::instance()->stopCapture();
     
     // 버튼 정리
     if (backButton) {
@@ -152,28 +186,46 @@ void GameWindow::setupGame()
     raise();
     activateWindow();
     qDebug() << "GameWindow shown. Size:" << size();
-    player = QRect(50, height()/2 - PLAYER_SIZE/2, PLAYER_SIZE, PLAYER_SIZE);
-    targetY = height()/2 - PLAYER_SIZE/2;
+    // 게임 규칙은 창 크기를 월드 크기로 시작 (이후 위젯과 무관하게 스텝 단위로 진행)
+    // 멀티플레이어 클라이언트는 game_started에서 호스트의 월드 크기로 바꿈 (보드마다 화면이 달라도 같은 레벨/stateHash)
+    // 장애물 생성도 시뮬레이션 스텝 수로 (싱글플레이어는 바로, 멀티플레이어는 게임 시작 시 호스트만)
+    GameSimulation::Config simConfig;
+    simConfig.width = width();
+    simConfig.height = height();
+    simConfig.spawning = !isMultiplayerMode;
+    // 음 모드 레벨 (LEVEL_MODE=scale|melody): 틈이 부를 음에 맞춰 배치됨
+    const QString levelMode = qEnvironmentVariable("LEVEL_MODE");
+    if (levelMode == "scale")
+        simConfig.levelMode = LevelGenerator::ScaleWalk;
+    else if (levelMode == "melody")
+        simConfig.levelMode = LevelGenerator::Melody;
+    const QString levelScale = qEnvironmentVariable("LEVEL_SCALE");
+    if (levelScale == "minor")
+        simConfig.scale = LevelGenerator::Minor;
+    else if (levelScale == "pentatonic")
+        simConfig.scale = LevelGenerator::Pentatonic;
+    else if (levelScale == "chromatic")
+        simConfig.scale = LevelGenerator::Chromatic;
+    if (qEnvironmentVariableIsSet("LEVEL_INTERVAL"))
+        simConfig.maxInterval = qMax(1, qEnvironmentVariableIntValue("LEVEL_INTERVAL"));
+    simConfig.melody = qEnvironmentVariableIntValue("LEVEL_MELODY");
+    // 보드별 난이도 프로파일 (DIFFICULTY=normal|classic|practice|hard)
+    simConfig.difficulty = &DifficultyEngine::profile(qEnvironmentVariable("DIFFICULTY"));
+    qDebug() << "Difficulty profile:" << simConfig.difficulty->name;
+    simulation.reset(simConfig);
+    simulation.setCollider(this);
+    previousPlayerY = simulation.player().y();
     
     // 타이머는 이미 QObject(parent)로 관리되므로 중복 생성 방지
-    if (!gameTimer) {
-        gameTimer = new QTimer(this);
-        connect(gameTimer, &QTimer::timeout, this, &GameWindow::updateGame);
+    // 시뮬레이션은 SIMULATION_HZ 고정 간격, 틱은 화면 주사율에 맞춘 PreciseTimer (GL이면 vsync)
+    if (!frameScheduler) {
+        frameScheduler = new FrameScheduler(SIMULATION_HZ, this);
+        connect(frameScheduler, &FrameScheduler::step, this, &GameWindow::updateGame);
+        connect(frameScheduler, &FrameScheduler::frame, this, &GameWindow::renderFrame);
+        const qreal refreshRate = screen->refreshRate();
+        frameScheduler->setTickInterval(refreshRate > 1.0 ? qFloor(1000.0 / refreshRate) : 16);
     }
-    gameTimer->start(16); // 약 60 FPS
-    
-    if (!obstacleTimer) {
-        obstacleTimer = new QTimer(this);
-        connect(obstacleTimer, &QTimer::timeout, this, &GameWindow::spawnObstacles);
-
-        // 싱글플레이어 모드이거나 멀티플레이어 호스트일 때만 타이머 시작
-        if (!isMultiplayerMode) {
-            obstacleTimer->start(2000); // 2초마다 장애물 생성
-        }
-        // 멀티플레이어 모드에서는 호스트가 게임 시작 후에 타이머를 시작함
-
-    }
-    obstacleTimer->start(2000); // 2초마다 장애물 생성
+    frameScheduler->start();
     
     if (!pitchTimer) {
         pitchTimer = new QTimer(this);
@@ -182,32 +234,11 @@ void GameWindow::setupGame()
     pitchTimer->start(50); // 20Hz로 피치 읽기
     
     gameRunning = true;
-    score = 0;
-    obstacles.clear();
-    stars.clear();
-    
-    // 별 모양 초기화 - 둥근 모서리와 부드러운 곡선 (캐싱)
-    if (starPath.isEmpty()) {
-        starPath = QPainterPath();
-        const qreal angleStep = M_PI / STAR_POINTS;
-        const qreal controlDist = CORNER_SMOOTHNESS;
-        for (int i = 0; i < STAR_POINTS * 2; ++i) {
-            qreal radius = (i % 2 == 0) ? starSize * OUTER_RADIUS / 2 : starSize * INNER_RADIUS / 2;
-            qreal angle = i * angleStep;
-            qreal nextAngle = (i + 1) * angleStep;
-            QPointF point(radius * sin(angle), -radius * cos(angle));
-            qreal nextRadius = ((i + 1) % 2 == 0) ? starSize * OUTER_RADIUS / 2 : starSize * INNER_RADIUS / 2;
-            QPointF nextPoint(nextRadius * sin(nextAngle), -nextRadius * cos(nextAngle));
-            if (i == 0) starPath.moveTo(point);
-            QPointF ctrl1 = point + QPointF(radius * controlDist * cos(angle), radius * controlDist * sin(angle));
-            QPointF ctrl2 = nextPoint - QPointF(nextRadius * controlDist * cos(nextAngle), nextRadius * controlDist * sin(nextAngle));
-            starPath.cubicTo(ctrl1, ctrl2, nextPoint);
-        }
-        starPath.closeSubpath();
-    }
     
     // 마이크 프로세스 시작
-    startMicProcess();
+    AudioEngine::instance()->startCapture();
+    // 효과음은 작업 스레드에서 미리 디코딩 (첫 별/충돌 때 NFS 읽기를 기다리지 않음)
+    AudioEngine::instance()->preloadSounds(QStringList() << "/mnt/nfs/wav/item.wav" << "/mnt/nfs/wav/scratch.wav");
     
 
     // 뒤로가기 버튼 설정 (중복 생성 방지)
@@ -229,6 +260,9 @@ void GameWindow::setupGame()
     }
     playerImage = cachedPlayerPixmap;
 
+    // 렌더링 백엔드 선택 (RENDER_BACKEND=gl이면 OpenGL, 불가능하면 래스터)
+    setupRenderBackend();
+
     // 멀티플레이어 모드인 경우 네트워크 초기화
     if (isMultiplayerMode) {
         startMultiplayer();
@@ -242,59 +276,37 @@ void GameWindow::setupGame()
 
     
     // 초기 화면 그리기
-    update();
-}
-
-void GameWindow::startMicProcess()
-{
-    if (micProcess) {
-        stopMicProcess();
-    }
-    
-    micProcess = new QProcess(this);
-    QString workingDir = QApplication::applicationDirPath();
-    micProcess->setWorkingDirectory(workingDir);
-    qDebug() << "Starting mic process in directory:" << workingDir;
-    micProcess->start("./mic", QStringList(), QIODevice::ReadWrite);
-    
-    // mic 프로세스 시작 실패 시 기본값 생성
-    if (!micProcess->waitForStarted(1000)) {
-        qDebug() << "Creating default pitch_score file...";
-        QFile defaultFile("/tmp/pitch_score");
-        if (defaultFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            QTextStream stream(&defaultFile);
-            stream << "15 500.0\n";  // 중간 높이와 적절한 볼륨으로 설정
-            defaultFile.close();
-        }
-    }
-    
-    if (micProcess->waitForStarted()) {
-        qDebug() << "Mic process started successfully";
-    } else {
-        qDebug() << "Mic not available, game will run with default values";
-        // 마이크가 없어도 게임이 실행되도록 프로세스 유지
-        QFile file("/tmp/pitch_score");
-        if (!file.exists()) {
-            QFile defaultFile("/tmp/pitch_score");
-            if (defaultFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
-                QTextStream stream(&defaultFile);
-                stream << "15 500.0\n";  // 중간 높이와 적절한 볼륨으로 설정
-                defaultFile.close();
-            }
-        }
-    }
+    repaintAll();
 }
 
-void GameWindow::stopMicProcess()
+void GameWindow::setupRenderBackend()
 {
-    if (micProcess) {
-        micProcess->terminate();
-        if (!micProcess->waitForFinished(3000)) {
-            micProcess->kill();
-        }
-        micProcess->deleteLater();
-        micProcess = nullptr;
+#ifdef GAME_GL_BACKEND
+    if (glView || qEnvironmentVariable("RENDER_BACKEND") != "gl") return;
+    QString renderer;
+    if (!GLGameView::hardwareAvailable(&renderer)) {
+        qDebug() << "OpenGL backend unavailable, using raster. Renderer:" << renderer;
+        return;
     }
+    glView = new GLGameView(this);
+    glView->setScene(&scene);
+    glView->setHudPainter([this](QPainter &painter) { paintHud(painter); });
+    // 버퍼 스왑(vsync)마다 다음 프레임 진행
+    if (frameScheduler) {
+        connect(glView, &QOpenGLWidget::frameSwapped, frameScheduler, &FrameScheduler::tick);
+        frameScheduler->setVsyncDriven(true);
+    }
+    setCentralWidget(glView);
+    prepareAssets();
+    glView->setAssets(backgroundPixmap, spritePixmaps);
+    glView->show();
+    if (backButton)
+        backButton->raise();
+    qDebug() << "Render backend: OpenGL on" << renderer;
+#else
+    if (qEnvironmentVariable("RENDER_BACKEND") == "gl")
+        qDebug() << "OpenGL backend not built (Qt without OpenGL), using raster";
+#endif
 }
 
 void GameWindow::readPitchData()
@@ -317,17 +329,9 @@ void GameWindow::readPitchData()
                 float volume = parts[1].toFloat(&ok2);
                 
                 if (ok1 && ok2) {
+                    // 목표 높이는 시뮬레이션 스텝에서 계산 (GameSimulation::targetYForPitch)
                     currentPitch = pitch;
                     currentVolume = volume;
-                    
-                    // 볼륨이 일정 이상일 때만 계산
-                    if (currentPitch > 0 && currentVolume > 0.1f) {
-                        // 정적 변수로 캐싱
-                        static const int pitchRange = 37 - 1; // 1~37 범위
-                        const float normalizedPitch = (currentPitch - 1.0f) / pitchRange;
-                        targetY = (1.0f - normalizedPitch) * (height() - PLAYER_SIZE);
-                        targetY = qBound(0, targetY, height() - PLAYER_SIZE);
-                    }
                 }
             }
         }
@@ -336,204 +340,351 @@ void GameWindow::readPitchData()
 
 void GameWindow::paintEvent(QPaintEvent *event)
 {
-    Q_UNUSED(event)
+    // OpenGL 백엔드 사용 중이면 자식 GL 뷰가 전체를 그림
+    if (glView) return;
+
+    // 채우기 비율 계측: 이번에 다시 그리는 픽셀 수 (Qt가 이 영역으로 클리핑함)
+    int pixels = 0;
+    for (const QRect &r : event->region())
+        pixels += r.width() * r.height();
+    lastPaintedPixels = pixels;
+    paintedPixels += quint64(pixels);
+    ++paintedFrames;
+
+    // 장면은 updateGame(또는 repaintAll)에서 이미 만들어져 있음 - 여기서는 그리기만 함
+    prepareAssets();
+
+    QElapsedTimer paintClock;
+    paintClock.start();
+    const qreal scale = renderScaler.scale();
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing, false); // 성능: 안티앨리어싱 OFF
-    // 배경 그리기 (이미지 최적화)
-    static QPixmap bgPixmap;
-    static QSize lastBgSize;
-    if (bgPixmap.isNull() || lastBgSize != size()) {
-        QPixmap rawBg;
-        if (rawBg.load("/mnt/nfs/background.png")) {
-            bgPixmap = rawBg.scaled(size(), Qt::IgnoreAspectRatio, Qt::FastTransformation); // 성능: FastTransformation
-            lastBgSize = size();
-        } else {
-            bgPixmap = QPixmap();
-        }
-    }
-    if (!bgPixmap.isNull()) {
-        painter.drawPixmap(rect(), bgPixmap);
+    const quint64 allocationsBefore = AllocationCounter::threadCount();
+    if (renderScaler.isScaled()) {
+        // 내부 해상도 이미지에 장면을 그리고 바뀐 영역만 확대 복사 (HUD 텍스트는 원래 해상도로)
+        QImage &frame = renderScaler.frame(size());
+        QPainter framePainter(&frame);
+        framePainter.setClipRegion(renderScaler.mapToFrame(event->region()));
+        paintScene(framePainter, scale);
+        framePainter.end();
+        for (const QRect &r : event->region())
+            painter.drawImage(QRectF(r), frame, QRectF(r.x() * scale, r.y() * scale, r.width() * scale, r.height() * scale));
     } else {
-        painter.fillRect(rect(), Qt::black);
+        paintScene(painter, 1.0);
     }
-    
-    // 별 그리기 - 활성 별만 그리기
-    painter.setBrush(QColor(255, 223, 0));  // 밝은 노란색
-    painter.setPen(Qt::NoPen);
-    
-    // 눈과 미소 미리 생성
-    QPainterPath smilePath;
-    const qreal smileWidth = starSize/5;
-    const qreal smileHeight = starSize/8;
-    smilePath.moveTo(-smileWidth, 0);
-    smilePath.quadTo(0, smileHeight, smileWidth, 0);
-    
-    for (const Star& star : stars) {
-        if (!star.active) continue;
-        
-        painter.save();
-        painter.translate(star.pos);
-        
-        // 별 모양 그리기
-        painter.drawPath(starPath);
-        
-        // 얼굴 그리기
-        painter.setPen(QPen(Qt::black, 2));
-        
-        // 눈
-        painter.setBrush(Qt::black);
-        painter.drawEllipse(QPointF(-starSize/8, -starSize/8), 2.5, 2.5);
-        painter.drawEllipse(QPointF(starSize/8, -starSize/8), 2.5, 2.5);
-        
-        // 미소
-        painter.drawPath(smilePath);
-        
-        painter.restore();
-    }
-    
-    // 장애물 그리기 (brick_pillar.png의 중앙 기둥 부분만 세로만 스케일, 가로는 원본 비율)
-    static QPixmap pillarPixmap;
-    static QMap<int, QPixmap> pillarVCache; // height별 캐시
-    static int lastMaxPillarHeight = 0;
-    static QPixmap croppedPillar;
-    if (pillarPixmap.isNull())
-        pillarPixmap.load("/mnt/nfs/brick_pillar.png");
-    const int REAL_PILLAR_WIDTH = 60;
-    // 1. 현재 장애물 중 가장 높은 높이 계산 (장애물 없으면 0)
-    int maxPillarHeight = 0;
-    for (const QRect &obstacle : obstacles) {
-        if (obstacle.height() > maxPillarHeight)
-            maxPillarHeight = obstacle.height();
-    }
-    // 2. 가장 높은 기둥 높이가 바뀌었을 때만 크롭 (불필요한 연산 방지)
-    if (!pillarPixmap.isNull() && maxPillarHeight > 0 && maxPillarHeight != lastMaxPillarHeight) {
-        int imgW = pillarPixmap.width();
-        int imgH = pillarPixmap.height();
-        int srcX = (imgW - REAL_PILLAR_WIDTH) / 2;
-        int cropH = qMin(maxPillarHeight, imgH); // 이미지보다 높으면 이미지 끝까지만
-        croppedPillar = pillarPixmap.copy(srcX, 0, REAL_PILLAR_WIDTH, cropH);
-        pillarVCache.clear(); // 높이별 캐시도 무효화
-        lastMaxPillarHeight = maxPillarHeight;
+    paintHud(painter);
+    lastPaintAllocations = AllocationCounter::threadCount() - allocationsBefore;
+    maxPaintAllocations = qMax(maxPaintAllocations, lastPaintAllocations);
+    painter.end();
+
+    // 그리기 시간이 프레임 예산을 계속 넘으면 배율 조절 후 전체 다시 그림
+    const double budgetMs = frameScheduler ? frameScheduler->stepMs() : 16.0;
+    if (renderScaler.reportFrame(paintClock.nsecsElapsed() / 1.0e6, budgetMs))
+        update();
+}
+
+// 작업 스레드에서 준비된 배경 (이미 화면 포맷이므로 QPixmap 변환은 복사 수준)
+// 로드에 실패해도 같은 크기로는 다시 요청하지 않음
+void GameWindow::onBackgroundReady(const QImage &image, const QSize &viewSize)
+{
+    backgroundPixmap = image.isNull() ? QPixmap() : QPixmap::fromImage(image);
+    backgroundSize = viewSize;
+    backgroundScroll = 0;
+#ifdef GAME_GL_BACKEND
+    if (glView)
+        glView->setAssets(backgroundPixmap, spritePixmaps);
+#endif
+    repaintAll();
+}
+
+// 배경/스프라이트 에셋 준비 (바뀐 경우에만 다시 만들고 장면 크기 정보와 GL 백엔드에 전달)
+void GameWindow::prepareAssets()
+{
+    bool changed = false;
+    // 창 크기가 배경과 다르면 작업 스레드에 다시 요청 (완료되면 onBackgroundReady, 그 전까지는 이전 배경 사용)
+    if (backgroundSize != size() && backgroundLoader)
+        backgroundLoader->request(size(), BackgroundLoader::nativeFormat(QApplication::primaryScreen()), parallaxEnabled);
+    if (!pillarRenderer.isLoaded()) {
+        pillarRenderer.load();
+        spritePixmaps[GameScene::SpritePillarBody] = pillarRenderer.body();
+        spritePixmaps[GameScene::SpriteTopCap] = pillarRenderer.cap(true);
+        spritePixmaps[GameScene::SpriteBottomCap] = pillarRenderer.cap(false);
+        changed = true;
+    }
+    if (starSprite.prepare(GameSimulation::STAR_SIZE, devicePixelRatioF(), starFrames)) {
+        spritePixmaps[GameScene::SpriteStar] = starSprite.pixmap();
+        changed = true;
+    }
+    // 플레이어 이미지가 없으면 흰색 원, 다른 플레이어는 파란색 원
+    if (!playerImage.isNull() && spritePixmaps[GameScene::SpritePlayer].cacheKey() != playerImage.cacheKey()) {
+        spritePixmaps[GameScene::SpritePlayer] = playerImage;
+        changed = true;
+    }
+    const GameScene::SpriteId circleSprites[2] = { GameScene::SpritePlayer, GameScene::SpriteRemotePlayer };
+    const QColor circleColors[2] = { Qt::white, Qt::blue };
+    for (int i = 0; i < 2; ++i) {
+        QPixmap &circle = spritePixmaps[circleSprites[i]];
+        if (!circle.isNull()) continue;
+        circle = QPixmap(PLAYER_SIZE, PLAYER_SIZE);
+        circle.fill(Qt::transparent);
+        QPainter painter(&circle);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(circleColors[i]);
+        painter.drawEllipse(0, 0, PLAYER_SIZE, PLAYER_SIZE);
+        changed = true;
     }
+    if (!changed) return;
+
+    GameScene::SpriteMetrics metrics;
+    for (int i = 0; i < GameScene::SpriteCount; ++i) {
+        metrics.pixelSize[i] = spritePixmaps[i].size();
+        metrics.pixelRatio[i] = spritePixmaps[i].devicePixelRatio();
+    }
+    metrics.starFrames = starSprite.frameCount();
+    scene.setMetrics(metrics);
+    playerMask = CollisionMask::fromPixmap(spritePixmaps[GameScene::SpritePlayer]);
+
+#ifdef GAME_GL_BACKEND
+    if (glView)
+        glView->setAssets(backgroundPixmap, spritePixmaps);
+#endif
+}
+
+// 게임 상태 → 그리기 항목 배열 (두 렌더링 백엔드가 공유)
+// 게임 상태는 마지막 스텝 기준이므로 직전 스텝과의 사이를 renderAlpha로 보간해 배치
+// 장애물/별은 마지막 스텝에서 모두 같은 거리(난이도에 따라 다름)만큼 이동했으므로 남은 비율만큼 뒤로 밀어서 그림
+void GameWindow::buildScene()
+{
+    prepareAssets();
+    scene.begin(size());
+    const GameSimulation::ObstacleStore &obstacles = simulation.obstacles();
+    const GameSimulation::StarStore &stars = simulation.stars();
+    const QRect &player = simulation.player();
+    const qreal lag = 1.0 - renderAlpha;
+    if (parallaxEnabled && !backgroundPixmap.isNull()) {
+        const int period = backgroundPixmap.width();
+        const int scroll = backgroundScroll - qRound(BACKGROUND_SPEED * lag);
+        scene.setBackgroundOffset(((scroll % period) + period) % period);
+    }
+    const qreal starLag = simulation.lastScroll() * lag;
+    for (int i = 0; i < stars.size(); ++i) {
+        if (!stars.isAlive(i)) continue;
+        const QPoint center = stars.center(i);
+        const QPointF pos(center.x() + starLag, center.y());
+        // 애니메이션 프레임은 별의 x 위치로 결정 (별마다 별도 상태 없음)
+        scene.addStar(worldToView(pos), int(pos.x()) / 8);
+    }
+    const int obstacleLag = qRound(simulation.lastScroll() * lag);
     for (int i = 0; i < obstacles.size(); ++i) {
-        const QRect &obstacle = obstacles[i];
-        int h = obstacle.height();
-        int x = obstacle.x() + (obstacle.width() - REAL_PILLAR_WIDTH) / 2;
-        int y = obstacle.y();
-        if (!croppedPillar.isNull()) {
-            QPixmap scaled;
-            if (pillarVCache.contains(h)) {
-                scaled = pillarVCache.value(h);
-            } else {
-                // 3. 크롭된 이미지를 각 기둥 높이에 맞게 세로로만 스케일
-                scaled = croppedPillar.scaled(REAL_PILLAR_WIDTH, h, Qt::IgnoreAspectRatio, Qt::FastTransformation); // FastTransformation로 성능 향상
-                pillarVCache.insert(h, scaled);
-            }
-            painter.drawPixmap(x, y, REAL_PILLAR_WIDTH, h, scaled);
-        } else {
-            painter.setBrush(Qt::red);
-            painter.setPen(Qt::NoPen);
-            painter.drawRect(x, y, REAL_PILLAR_WIDTH, h);
-        }
+        if (!obstacles.isAlive(i)) continue;
+        // 위쪽 장애물은 캡이 아래(틈 쪽)에 붙음
+        scene.addPillar(worldToView(obstacles.rect(i).translated(obstacleLag, 0)), obstacles.hasFlag(i, GameSimulation::ObstacleStore::TopObstacle));
     }
-    
-    // 플레이어 그리기 (이미지)
-    if (!playerImage.isNull()) {
-        int px = player.x() + (player.width() - playerImage.width())/2;
-        int py = player.y() + (player.height() - playerImage.height())/2;
-        painter.drawPixmap(px, py, playerImage.width(), playerImage.height(), playerImage);
+    const int playerY = previousPlayerY + qRound((player.y() - previousPlayerY) * renderAlpha);
+    scene.addPlayer(worldToView(QRect(player.x(), playerY, player.width(), player.height())));
+    if (isMultiplayerMode) {
+        for (const PlayerData &otherPlayer : otherPlayers)
+            scene.addRemotePlayer(QRect(otherPlayer.renderPos, QSize(PLAYER_SIZE, PLAYER_SIZE)));
+    }
+    scene.finish();
+}
+
+// 월드(시뮬레이션) 좌표 → 창 좌표
+// 싱글플레이어와 호스트는 창 크기가 곧 월드 크기, 멀티플레이어 클라이언트는 호스트의 월드를 자기 화면에 맞춰 늘려 그림
+// (위치만 변환하고 스프라이트는 원래 크기로 그림)
+QPointF GameWindow::worldToView(const QPointF &point) const
+{
+    const GameSimulation::Config &world = simulation.config();
+    if (world.width == width() && world.height == height()) return point;
+    return QPointF(point.x() * width() / qMax(1, world.width), point.y() * height() / qMax(1, world.height));
+}
+
+QRect GameWindow::worldToView(const QRect &rect) const
+{
+    const GameSimulation::Config &world = simulation.config();
+    if (world.width == width() && world.height == height()) return rect;
+    const QPoint topLeft = worldToView(QPointF(rect.topLeft())).toPoint();
+    const QPoint bottomRight = worldToView(QPointF(rect.x() + rect.width(), rect.y() + rect.height())).toPoint();
+    return QRect(topLeft, bottomRight - QPoint(1, 1));
+}
+
+// 래스터 백엔드: 배경 + 그리기 항목을 순서대로 복사
+// scale < 1이면 내부 해상도 이미지에 그림 - 배경은 그 해상도로 미리 줄인 것을 1:1 복사하고 스프라이트는 배율 변환
+void GameWindow::paintScene(QPainter &painter, qreal scale)
+{
+    const QPixmap &background = scale < 1.0 ? renderScaler.background(backgroundPixmap) : backgroundPixmap;
+    if (!background.isNull()) {
+        // 패럴랙스 띠는 스크롤 위치부터 그리고 띠 끝을 넘으면 처음부터 이어서 그림
+        const int offset = qRound(scene.backgroundOffset() * scale) % background.width();
+        painter.drawPixmap(0, 0, background, offset, 0, -1, -1);
+        const int first = background.width() - offset;
+        if (first < painter.device()->width())
+            painter.drawPixmap(first, 0, background, 0, 0, offset, -1);
     } else {
-        painter.setBrush(Qt::white);
-        painter.setPen(Qt::NoPen);
-        painter.drawEllipse(player);
+        painter.fillRect(rect(), Qt::black);
     }
-    
 
-    // 텍스트 정보 표시 - 캐싱 및 최적화
-    static QFont infoFont("Arial", 12);  // 정적 폰트 객체
-    painter.setFont(infoFont);
+    if (scale < 1.0)
+        painter.scale(scale, scale);
+    for (const GameScene::DrawItem &item : scene.items())
+        painter.drawPixmap(item.target, spritePixmaps[item.sprite], item.source);
+}
+
+// 고정 문구와 폰트는 한 번만 배치
+void GameWindow::initHudLabels()
+{
+    const QFont infoFont("Arial", 12);
+    const QFont lobbyFont("Arial", 24, QFont::Bold);
+    scoreLabel.setFont(infoFont);
+    playerLabel.setFont(infoFont);
+    modeLabel.setFont(infoFont);
+    lobbyTitleLabel.setFont(lobbyFont);
+    lobbyCountLabel.setFont(lobbyFont);
+    lobbyHostLabel.setFont(lobbyFont);
+    pitchLabel.setFont(infoFont);
+    volumeLabel.setFont(infoFont);
+    countdownLabel.setFont(QFont("Arial", 48, QFont::Bold));
+
+    lobbyTitleLabel.setText("Waiting for players...");
+    lobbyHostLabel.setText("You are the host");
+    playerLabel.setText("Player: No Player");
+}
+
+// 값이 바뀐 텍스트만 다시 만들고 배치 (대부분의 프레임은 정수 비교만 함)
+void GameWindow::updateHudLabels()
+{
+    if (simulation.score() != hudScore) {
+        hudScore = simulation.score();
+        scoreLabel.setText(QString("Score: %1").arg(hudScore));
+    }
+#ifdef QT_DEBUG
+    if (currentPitch != hudPitch) {
+        hudPitch = currentPitch;
+        pitchLabel.setText(QString("Pitch: %1").arg(hudPitch));
+    }
+    const int volume = qRound(currentVolume * 100.0f);
+    if (volume != hudVolume) {
+        hudVolume = volume;
+        volumeLabel.setText(QString("Volume: %1").arg(hudVolume / 100.0, 0, 'f', 2));
+    }
+#endif
+    if (showStatsOverlay && (!statsClock.isValid() || statsClock.elapsed() >= STATS_REFRESH_MS)) {
+        statsClock.start();
+        updateStatsLabels();
+    }
+
+    if (!isMultiplayerMode) return;
+
+    const int playerCount = otherPlayers.size() + 1;
+    if (playerCount != hudPlayerCount) {
+        hudPlayerCount = playerCount;
+        modeLabel.setText(QString("Multiplayer Mode - Players: %1").arg(playerCount));
+        lobbyCountLabel.setText(QString("Players: %1/4").arg(playerCount));
+    }
+    if (countdownValue != hudCountdown) {
+        hudCountdown = countdownValue;
+        countdownLabel.setText(QString::number(countdownValue));
+    }
+    // 나간 플레이어의 이름이 남아 있으면 비우고 다시 만듦
+    if (remoteNameLabels.size() > otherPlayers.size())
+        remoteNameLabels.clear();
+    for (const PlayerData &otherPlayer : otherPlayers) {
+        if (!remoteNameLabels.contains(otherPlayer.playerId)) {
+            HudLabel &label = remoteNameLabels[otherPlayer.playerId];
+            label.setFont(QFont("Arial", 12));
+            label.setText(otherPlayer.playerId);
+        }
+    }
+}
+
+// 텍스트 HUD (두 백엔드 공용, GL 백엔드는 GL 그리기 후 같은 위젯에 QPainter로 호출)
+// 점수/이름/대기실/카운트다운은 HudLabel에 미리 배치된 텍스트를 그리기만 함
+void GameWindow::paintHud(QPainter &painter)
+{
+    updateHudLabels();
 
-    // 멀티플레이어 모드에서 다른 플레이어들 그리기
     if (isMultiplayerMode) {
-        painter.setBrush(Qt::blue);
-        painter.setPen(Qt::blue);
+        // 플레이어 ID를 흰색으로 표시
+        painter.setPen(Qt::white);
         for (const PlayerData &otherPlayer : otherPlayers) {
-            // 다른 플레이어를 파란색 원으로 그리기
-            painter.drawEllipse(otherPlayer.x, otherPlayer.y, PLAYER_SIZE, PLAYER_SIZE);
-            
-            // 플레이어 ID를 흰색으로 표시
-            painter.setPen(Qt::white);
-            painter.drawText(otherPlayer.x, otherPlayer.y - 5, otherPlayer.playerId);
-            painter.setPen(Qt::blue);
+            const auto it = remoteNameLabels.constFind(otherPlayer.playerId);
+            if (it != remoteNameLabels.constEnd())
+                it->draw(painter, otherPlayer.renderPos.x(), otherPlayer.renderPos.y() - 5);
         }
         
         // 대기실 화면 그리기
         if (isInLobby && !isGameStarted) {
-            painter.setPen(Qt::white);
-            QFont lobbyFont("Arial", 24, QFont::Bold);
-            painter.setFont(lobbyFont);
-            
-            QString lobbyText = "Waiting for players...";
-            QFontMetrics fm(lobbyFont);
-            int textX = (width() - fm.horizontalAdvance(lobbyText)) / 2;
-            painter.drawText(textX, height() / 2 - 50, lobbyText);
-            
-            QString playerCountText = QString("Players: %1/4").arg(otherPlayers.size() + 1);
-            int countX = (width() - fm.horizontalAdvance(playerCountText)) / 2;
-            painter.drawText(countX, height() / 2, playerCountText);
-            
+            const int centerX = width() / 2;
+            lobbyTitleLabel.draw(painter, centerX, height() / 2 - 50, HudLabel::AlignCenter);
+            lobbyCountLabel.draw(painter, centerX, height() / 2, HudLabel::AlignCenter);
             // 호스트 표시
-            if (isHost) {
-                QString hostText = "You are the host";
-                int hostX = (width() - fm.horizontalAdvance(hostText)) / 2;
-                painter.drawText(hostX, height() / 2 + 50, hostText);
-            }
+            if (isHost)
+                lobbyHostLabel.draw(painter, centerX, height() / 2 + 50, HudLabel::AlignCenter);
         }
         
         // 게임 시작 카운트다운 그리기
         if (countdownValue > 0) {
             painter.setPen(Qt::yellow);
-            QFont countdownFont("Arial", 48, QFont::Bold);
-            painter.setFont(countdownFont);
-            
-            QString countdownText = QString::number(countdownValue);
-            QFontMetrics fm(countdownFont);
-            int textX = (width() - fm.horizontalAdvance(countdownText)) / 2;
-            int textY = (height() + fm.height()) / 2;
-            painter.drawText(textX, textY, countdownText);
+            countdownLabel.draw(painter, width() / 2, (height() + countdownLabel.height()) / 2, HudLabel::AlignCenter);
         }
         
         // 멀티플레이어 모드임을 표시
         painter.setPen(Qt::white);
-        painter.drawText(10, 25, QString("Multiplayer Mode - Players: %1").arg(otherPlayers.size() + 1));
+        modeLabel.draw(painter, 10, 25);
     }
     
-    // 점수와 피치 정보 표시 (오른쪽 상단)
-
+    // 점수와 플레이어 정보 표시 (오른쪽 상단)
     painter.setPen(Qt::white);
     
-    // 텍스트 위치 계산 (매 프레임마다 계산하지 않도록 최적화 가능)
-    static QFontMetrics fm(infoFont);
     const int rightMargin = 10;
     const int topMargin = 25;
     const int lineSpacing = 20;
-    
-    // 필요한 문자열만 생성
-    QString scoreText = QString("Score: %1").arg(score);
-    QString playerText = QString("Player: %1").arg(currentPlayerName.isEmpty() ? "No Player" : currentPlayerName);
-    
-    // 오른쪽 정렬 텍스트
-    int rightEdge = width() - rightMargin;
-    painter.drawText(rightEdge - fm.horizontalAdvance(scoreText), topMargin, scoreText);
-    painter.drawText(rightEdge - fm.horizontalAdvance(playerText), topMargin + lineSpacing * 3, playerText);
+    const int rightEdge = width() - rightMargin;
+    scoreLabel.draw(painter, rightEdge, topMargin, HudLabel::AlignRight);
+    playerLabel.draw(painter, rightEdge, topMargin + lineSpacing * 3, HudLabel::AlignRight);
     
     // 디버그 정보는 조건부로 표시 (성능에 영향 줄이기)
 #ifdef QT_DEBUG
-    QString pitchText = QString("Pitch: %1").arg(currentPitch);
-    QString volumeText = QString("Volume: %1").arg(QString::number(currentVolume, 'f', 2));
-    painter.drawText(rightEdge - fm.horizontalAdvance(pitchText), topMargin + lineSpacing, pitchText);
-    painter.drawText(rightEdge - fm.horizontalAdvance(volumeText), topMargin + lineSpacing * 2, volumeText);
+    pitchLabel.draw(painter, rightEdge, topMargin + lineSpacing, HudLabel::AlignRight);
+    volumeLabel.draw(painter, rightEdge, topMargin + lineSpacing * 2, HudLabel::AlignRight);
 #endif
+
+    // 통계 오버레이 (F3으로 토글) - 보드별 오디오 주기 튜닝용
+    if (showStatsOverlay) {
+        int y = topMargin + lineSpacing * 4;
+        for (const HudLabel &label : statsLabels) {
+            label.draw(painter, rightEdge, y, HudLabel::AlignRight);
+            y += lineSpacing;
+        }
+    }
+}
+
+// 통계 오버레이 문구는 STATS_REFRESH_MS마다만 다시 만듦
+// (매 프레임 문자열을 만들면 오버레이 자체가 프레임마다 할당해 할당 계측을 가림)
+void GameWindow::updateStatsLabels()
+{
+    QStringList lines = AudioEngine::instance()->statsLines();
+    if (frameScheduler)
+        lines += frameScheduler->statsLines();
+    if (!glView)
+        lines << renderScaler.statusText();
+    const int fullPixels = width() * height();
+    const double avgPixels = paintedFrames ? double(paintedPixels) / paintedFrames : 0.0;
+    lines << (glView ? QString("Render: OpenGL (full frame)")
+        : QString("Repaint (F4): %1 last %2% avg %3%")
+        .arg(partialRepaint ? "partial" : "full")
+        .arg(fullPixels ? 100.0 * lastPaintedPixels / fullPixels : 0.0, 0, 'f', 0)
+        .arg(fullPixels ? 100.0 * avgPixels / fullPixels : 0.0, 0, 'f', 0));
+    if (AllocationCounter::isEnabled() && !glView)
+        lines << QString("Heap allocs/paint: last %1 max %2").arg(lastPaintAllocations).arg(maxPaintAllocations);
+
+    const int oldCount = statsLabels.size();
+    statsLabels.resize(lines.size());
+    for (int i = 0; i < lines.size(); ++i) {
+        if (i >= oldCount)
+            statsLabels[i].setFont(QFont("Arial", 12));
+        statsLabels[i].setText(lines.at(i));
+    }
 }
 
 void GameWindow::updateGame()
@@ -543,174 +694,167 @@ void GameWindow::updateGame()
     // 멀티플레이어 모드에서만 게임 시작 상태 체크
     if (isMultiplayerMode && !isGameStarted) return;
     
-    // 마이크 입력에 따른 플레이어 이동
-    if (currentVolume > 0.1f) {
-        int currentY = player.y();
-        int dy = targetY - currentY;
-        if (qAbs(dy) > 0) {
-            player.translate(0, qBound(-playerSpeed, dy, playerSpeed));
-        }
-    }
+    previousPlayerY = simulation.player().y();
     
-    // 키보드 입력
-    if (moveUp && player.y() > 0) {
-        player.translate(0, -playerSpeed);
-    }
-    if (moveDown && player.y() < height() - PLAYER_SIZE) {
-        player.translate(0, playerSpeed);
-    }
+    // 배경 패럴랙스 스크롤 (띠 너비로 순환)
+    if (parallaxEnabled && !backgroundPixmap.isNull())
+        backgroundScroll = (backgroundScroll + BACKGROUND_SPEED) % backgroundPixmap.width();
     
-    // 장애물 이동 및 제거 (역순 루프, reserve)
-    const int leftBoundary = 0;
-    const int obstacleSpeed = 3;
-    for (int i = obstacles.size() - 1; i >= 0; --i) {
-        QRect &obstacle = obstacles[i];
-        obstacle.translate(-obstacleSpeed, 0);
-        if (obstacle.x() + obstacle.width() < leftBoundary) {
-            obstacles.removeAt(i);
-            score++;
-        }
-    }
+    // 게임 규칙 한 스텝 (볼륨 임계값 판정까지 여기서 해서 시뮬레이션 입력은 정수/불리언만)
+    SimInput input;
+    input.pitchScore = currentPitch;
+    input.voiced = currentVolume > 0.1f;
+    input.up = moveUp;
+    input.down = moveDown;
+    const SimEvents events = simulation.step(input);
     
-    // 별 이동 및 충돌 검사 (역순 루프, reserve)
-    const QRectF playerBounds(player.x() - 15, player.y() - 15, player.width() + 30, player.height() + 30);
-    const int halfStarSize = starSize / 2;
-    const int starSpeed = 3;
-    for (int i = stars.size() - 1; i >= 0; --i) {
-        Star &star = stars[i];
-        if (!star.active) continue;
-        if (star.pos.x() + halfStarSize < leftBoundary) {
-            star.active = false;
-            continue;
-        }
-        star.pos.setX(star.pos.x() - starSpeed);
-        const qreal dx = qAbs(star.pos.x() - player.x());
-        const qreal dy = qAbs(star.pos.y() - player.y());
-        if (dx > starSize || dy > starSize) continue;
-        QRectF starRect(star.pos.x() - halfStarSize, star.pos.y() - halfStarSize, starSize, starSize);
-        if (playerBounds.intersects(starRect)) {
-            star.active = false;
-            score += 3;
-            playSound("/mnt/nfs/wav/item.wav");
-        }
+    // 기준음 모드: 다가오는 틈 높이에 맞는 음 재생
+    if (referenceToneEnabled) {
+        updateReferenceTone();
     }
     
-    // 충돌 검사
-    if (checkCollision()) {
+    for (int i = 0; i < events.starsCollected; ++i)
+        playSound("/mnt/nfs/wav/item.wav");
+    
+    if (events.collided) {
+        // 충돌 소리 재생
+        playSound("/mnt/nfs/wav/scratch.wav");
         gameOver();
         return;
     }
-    
-    // 비활성 별 정리 (reserve)
-    const int MAX_STARS = 25;
-    if (stars.size() > MAX_STARS) {
-        for (int i = stars.size() - 1; i >= 0; --i) {
-            if (!stars[i].active) {
-                stars.removeAt(i);
-            }
-        }
-    }
-    
 
     // 멀티플레이어 모드에서 네트워크 업데이트
+    // 내 위치는 broadcastTimer(BROADCAST_INTERVAL)로만 보냄 - 받는 쪽이 스냅샷 보간으로 부드럽게 그림
     if (isMultiplayerMode) {
-        updatePlayerPosition(player.x(), player.y(), score, false);
-        
         // 호스트가 주기적으로 게임 상태 전송 (2초마다)
         static int frameCount = 0;
-        if (isHost && isGameStarted && frameCount % 120 == 0) { // 120프레임마다 (약 2초)
+        if (isHost && isGameStarted && frameCount % (SIMULATION_HZ * 2) == 0) { // 2초 분량의 스텝마다
             sendGameState();
         }
         frameCount++;
     }
     
-    // 화면 갱신
-    update();
+    // 화면 갱신은 renderFrame에서 (스텝 수와 무관하게 틱당 한 번)
 }
 
-void GameWindow::spawnObstacles()
+void GameWindow::renderFrame(qreal alpha)
 {
     if (!gameRunning) return;
-    
-    // 멀티플레이어 모드에서만 게임 시작 상태와 호스트 조건 체크
-    if (isMultiplayerMode) {
-        if (!isGameStarted) return;
-        if (!isHost) return;
-    }
-    
-    // 고정된 시드값 사용 (모든 보드에서 동일한 랜덤 시퀀스 생성)
-    static QRandomGenerator fixedGenerator(FIXED_SEED); // 고정된 시드값
-    
-    // 장애물 개수에 따라 시드값 조정 (시간에 따른 변화)
-    int obstacleCount = obstacles.size() / 2; // 장애물 쌍의 개수
-    fixedGenerator.seed(FIXED_SEED + obstacleCount);
-    
-    // 장애물 간격을 플레이어가 통과할 수 있도록 조정
-    // 최소 간격: OBSTACLE_GAP/2 + PLAYER_SIZE + 여유공간
-    int minGapY = OBSTACLE_GAP/2 + PLAYER_SIZE + 50; // 최소 간격
-    int maxGapY = height() - OBSTACLE_GAP/2 - PLAYER_SIZE - 50; // 최대 간격
-    
-    // 범위가 유효한지 확인
-    if (minGapY >= maxGapY) {
-        minGapY = 150;
-        maxGapY = height() - 150;
+    if (isMultiplayerMode && !isGameStarted) return;
+    renderAlpha = alpha;
+    if (isMultiplayerMode)
+        updateRemotePlayers();
+    scheduleRepaint();
+}
+
+// 원격 플레이어는 받은 위치로 바로 옮기지 않고 고정 지연 뒤의 보간 위치에 그림 (끊기면 잠시 추정)
+void GameWindow::updateRemotePlayers()
+{
+    const qint64 now = remoteClock.elapsed();
+    for (PlayerData &otherPlayer : otherPlayers) {
+        if (otherPlayer.track.isEmpty()) continue;
+        otherPlayer.renderPos = worldToView(otherPlayer.track.sample(now, REMOTE_INTERPOLATION_DELAY)).toPoint();
     }
-    
-    int gapY = fixedGenerator.bounded(minGapY, maxGapY);
-    
-    // 위쪽 장애물
-    QRect topObstacle(width(), 0, OBSTACLE_WIDTH, gapY - OBSTACLE_GAP/2);
-    obstacles.append(topObstacle);
-    
-    // 아래쪽 장애물
-    QRect bottomObstacle(width(), gapY + OBSTACLE_GAP/2, OBSTACLE_WIDTH, height() - (gapY + OBSTACLE_GAP/2));
-    obstacles.append(bottomObstacle);
+}
+
+// 텍스트 HUD 영역 (스프라이트는 GameScene::damage가 담당)
+QRegion GameWindow::hudRegion() const
+{
+    QRegion region;
+    if (isMultiplayerMode) {
+        // 다른 플레이어 ID 텍스트, 왼쪽 위 모드 표시
+        for (const PlayerData &otherPlayer : otherPlayers)
+            region += QRect(otherPlayer.renderPos.x(), otherPlayer.renderPos.y() - 20, 160, 20);
+        region += QRect(0, 0, width() / 2, 35);
+    }
+    // 오른쪽 위 HUD (점수/피치/통계 오버레이)
+    const int hudLines = showStatsOverlay ? 21 : 4;
+    const int hudWidth = showStatsOverlay ? 480 : 240;
+    region += QRect(width() - hudWidth, 0, hudWidth, 30 + hudLines * 20);
+    return region;
+}
 
-    // 30% 확률로 별 생성 (고정된 시드값 사용)
-    if (fixedGenerator.bounded(100) < 30) {
-        // 별을 장애물 사이 통과 가능한 공간의 중앙에 배치
-        int starX = width() + OBSTACLE_WIDTH/2;
-        int starY = gapY; // 장애물 사이 공간의 중앙
-        stars.append(Star(QPointF(starX, starY)));
+// 전체 화면 갱신 (GL 백엔드면 장면을 새로 만들어 GL 뷰에 요청)
+void GameWindow::repaintAll()
+{
+    buildScene();
+#ifdef GAME_GL_BACKEND
+    if (glView) {
+        glView->update();
+        return;
     }
-    
-    // 게임 상태 전송은 updateGame에서 주기적으로 처리
+#endif
+    update();
 }
 
-bool GameWindow::checkCollision()
+void GameWindow::scheduleRepaint()
 {
-    for (const QRect &obstacle : obstacles) {
-        if (player.intersects(obstacle)) {
-            // 충돌 소리 재생
-            playSound("/mnt/nfs/wav/scratch.wav");
-            return true;
-        }
+    if (glView || !partialRepaint) {
+        repaintAll();
+        return;
     }
-    return false;
+    // 장면에서 달라진 항목의 이전/현재 위치 + HUD 텍스트 영역만 다시 그림
+    buildScene();
+    const QRegion hud = hudRegion();
+    update(scene.damage() + hud + lastDamage);
+    lastDamage = hud;
+}
+
+// GameScene::addPlayer와 같은 배치 (스프라이트 가운데가 히트박스 가운데)
+QRect GameWindow::playerSpriteRect(const QRect &hitBox) const
+{
+    return QRect(hitBox.x() + (hitBox.width() - playerMask.width()) / 2,
+                 hitBox.y() + (hitBox.height() - playerMask.height()) / 2,
+                 playerMask.width(), playerMask.height());
+}
+
+// 그려지는 기둥은 장애물 사각형보다 넓으므로 그만큼 넓혀서 광역 단계 후보 검색
+QRect GameWindow::queryRect(const QRect &hitBox) const
+{
+    // 에셋 준비 전(첫 프레임 전)에는 히트박스로 판정
+    if (playerMask.isNull()) return hitBox;
+    const int margin = qMax(0, (pillarRenderer.drawnWidth() - GameSimulation::OBSTACLE_WIDTH + 1) / 2);
+    return playerSpriteRect(hitBox).adjusted(-margin, 0, margin, 0);
+}
+
+// 정밀 단계: 기둥 조각별 사각형이 겹칠 때만 마스크 비트 AND
+bool GameWindow::collides(const QRect &obstacle, bool topObstacle, const QRect &hitBox) const
+{
+    if (playerMask.isNull()) return obstacle.intersects(hitBox);
+    return pillarRenderer.collides(obstacle, topObstacle, playerMask, playerSpriteRect(hitBox).topLeft());
 }
 
 void GameWindow::gameOver()
 {
     gameRunning = false;
     
+    // 오디오 출력 통계 로그
+    AudioEngine::instance()->dumpStats();
+    if (frameScheduler)
+        frameScheduler->dumpStats();
+    // 음 모드 레벨이면 틈을 지나는 동안 음을 맞춘 비율
+    if (simulation.pitchAccuracy() >= 0)
+        qDebug() << "Pitch accuracy:" << simulation.pitchAccuracy() << "%";
+    
+    // 기준음 정지
+    AudioEngine::instance()->stopReferenceTone();
+    referenceScore = 0;
+    
     // 멀티플레이어 모드에서 게임 오버 상태 전송
     if (isMultiplayerMode) {
-        updatePlayerPosition(player.x(), player.y(), score, true);
+        updatePlayerPosition(simulation.player().x(), simulation.player().y(), simulation.score(), true);
     }
     
-    stopMicProcess();
+    AudioEngine::instance()->stopCapture();
     
-    if (gameTimer) {
-        gameTimer->stop();
-    }
-    if (obstacleTimer) {
-        obstacleTimer->stop();
+    if (frameScheduler) {
+        frameScheduler->stop();
     }
     if (pitchTimer) {
         pitchTimer->stop();
     }
     
-    GameOverDialog *dialog = new GameOverDialog(score, currentPlayerName, this);
+    GameOverDialog *dialog = new GameOverDialog(simulation.score(), currentPlayerName, this);
     
     connect(dialog, &GameOverDialog::mainMenuRequested, this, [this]() {
         // 메인 윈도우로 돌아가라는 시그널 발생
@@ -726,22 +870,19 @@ void GameWindow::gameOver()
     connect(dialog, &GameOverDialog::restartRequested, this, [this]() {
         // 게임 재시작
         gameRunning = true;
-        score = 0;
-        obstacles.clear();
-        stars.clear();
         
-        // 플레이어 위치 초기화
-        player.moveTop(height()/2 - PLAYER_SIZE/2);
+        // 점수/장애물/플레이어 위치 초기화 (같은 설정으로 처음부터)
+        simulation.reset(simulation.config());
+        previousPlayerY = simulation.player().y();
         
         // 타이머 재시작
-        if (gameTimer) gameTimer->start();
-        if (obstacleTimer) obstacleTimer->start();
+        if (frameScheduler) frameScheduler->start();
         if (pitchTimer) pitchTimer->start();
         
         // 마이크 프로세스 재시작
-        startMicProcess();
+        AudioEngine::instance()->startCapture();
         
-        update();
+        repaintAll();
     });
     
     // 비모달로 표시 (show() 사용, exec() 대신)
@@ -764,6 +905,25 @@ void GameWindow::keyPressEvent(QKeyEvent *event)
     case Qt::Key_S:
         moveDown = true;
         break;
+    case Qt::Key_T:
+        referenceToneEnabled = !referenceToneEnabled;
+        if (!referenceToneEnabled) {
+            AudioEngine::instance()->stopReferenceTone();
+            referenceScore = 0;
+        }
+        break;
+    case Qt::Key_F3:
+        showStatsOverlay = !showStatsOverlay;
+        repaintAll();
+        break;
+    case Qt::Key_F4:
+        // 부분/전체 갱신 비교용 토글 (계측값도 초기화)
+        partialRepaint = !partialRepaint;
+        paintedPixels = 0;
+        paintedFrames = 0;
+        lastDamage = QRegion();
+        repaintAll();
+        break;
     case Qt::Key_Escape:
         close();
         break;
@@ -814,33 +974,23 @@ void GameWindow::setupBackButton()
     backButton->raise();
 }
 
-// 사운드 재생을 위한 도우미 함수
+// 사운드 재생을 위한 도우미 함수 (오디오 엔진 믹서로 전달, 블로킹 없음)
 void GameWindow::playSound(const QString &soundFile)
 {
-    // 이전 사운드 프로세스 정리
-    if (soundProcess) {
-        if (soundProcess->state() == QProcess::Running) {
-            soundProcess->terminate();
-            soundProcess->waitForFinished(100);
-        }
-        delete soundProcess;
-    }
-    
-    // 새 프로세스 시작
-    soundProcess = new QProcess(this);
-    soundProcess->start("./aplay", QStringList() << "-Dhw:0,0" << soundFile);
-    
-    // 시작 실패 시 절대 경로로 재시도
-    if (!soundProcess->waitForStarted(300)) {
-        qDebug() << "Failed to play sound. Trying absolute path...";
-        delete soundProcess;
-        
-        soundProcess = new QProcess(this);
-        soundProcess->start("/usr/bin/aplay", QStringList() << "-Dhw:0,0" << soundFile);
-        
-        if (!soundProcess->waitForStarted(300)) {
-            qDebug() << "Failed to play sound with absolute path too.";
-        }
+    AudioEngine::instance()->playSound(soundFile);
+}
+
+void GameWindow::updateReferenceTone()
+{
+    // 플레이어 앞의 첫 틈 중앙에 맞는 피치 점수 (없으면 0)
+    const int score = simulation.upcomingGapPitch();
+
+    if (score == referenceScore) return;
+    referenceScore = score;
+    if (score > 0) {
+        AudioEngine::instance()->setReferenceNote(score);
+    } else {
+        AudioEngine::instance()->stopReferenceTone();
     }
 }
 
@@ -852,11 +1002,8 @@ void GameWindow::goBackToMainWindow()
     gameRunning = false;
     
     // 모든 타이머 정지
-    if (gameTimer) {
-        gameTimer->stop();
-    }
-    if (obstacleTimer) {
-        obstacleTimer->stop();
+    if (frameScheduler) {
+        frameScheduler->stop();
     }
     if (pitchTimer) {
         pitchTimer->stop();
@@ -873,6 +1020,7 @@ void GameWindow::goBackToMainWindow()
 void GameWindow::setCurrentPlayer(const QString &playerName)
 {
     currentPlayerName = playerName;
+    playerLabel.setText(QString("Player: %1").arg(currentPlayerName.isEmpty() ? "No Player" : currentPlayerName));
 }
 
 
@@ -983,40 +1131,37 @@ void GameWindow::stopMultiplayer()
     qDebug() << "Multiplayer mode stopped";
 }
 
+// 위치는 BROADCAST_INTERVAL마다 나가므로 QJsonObject/QJsonDocument 대신 미리 잡아 둔 버퍼에 같은 필드의 JSON을 직접 씀
+// (playerId는 숫자 문자열이라 이스케이프할 문자가 없음, 받는 쪽은 그대로 QJsonDocument::fromJson)
 void GameWindow::updatePlayerPosition(int x, int y, int score, bool gameOver)
 {
     if (!isMultiplayerMode || !udpSocket) return;
     
-    try {
-        QJsonObject data;
-        data["type"] = "player_update";
-        data["playerId"] = playerId;
-        data["x"] = x;
-        data["y"] = y;
-        data["score"] = score;
-        data["gameOver"] = gameOver;
-        data["timestamp"] = QDateTime::currentMSecsSinceEpoch();
-        
-        QJsonDocument doc(data);
-        QByteArray datagram = doc.toJson();
-        
-        if (datagram.isEmpty()) {
-            qDebug() << "Empty datagram generated";
-            return;
-        }
-        
-        // 192.168.10.3~8 범위로 브로드캐스트
-        for (int i = 3; i <= 8; ++i) {
-            QHostAddress address(QString("192.168.10.%1").arg(i));
-            qint64 bytesSent = udpSocket->writeDatagram(datagram, address, BROADCAST_PORT);
-            
-            if (bytesSent != datagram.size()) {
-                qDebug() << "Failed to send datagram to" << address.toString();
-            }
-        }
-    } catch (...) {
-        qDebug() << "Exception in updatePlayerPosition";
+    const int size = qsnprintf(playerUpdateBuffer, PLAYER_UPDATE_SIZE,
+        "{\"type\":\"player_update\",\"playerId\":\"%s\",\"x\":%d,\"y\":%d,\"score\":%d,"
+        "\"gameOver\":%s,\"timestamp\":%lld}",
+        playerIdUtf8.constData(), x, y, score, gameOver ? "true" : "false",
+        static_cast<long long>(QDateTime::currentMSecsSinceEpoch()));
+    if (size <= 0 || size >= PLAYER_UPDATE_SIZE) {
+        qDebug() << "Player update datagram too large";
+        return;
     }
+    
+    sendToPeers(playerUpdateBuffer, size);
+}
+
+// 192.168.10.3~8 범위로 브로드캐스트
+void GameWindow::sendToPeers(const char *data, int size)
+{
+    for (const QHostAddress &address : peerAddresses) {
+        if (udpSocket->writeDatagram(data, size, address, BROADCAST_PORT) != size)
+            qDebug() << "Failed to send datagram to" << address.toString();
+    }
+}
+
+void GameWindow::sendToPeers(const QByteArray &datagram)
+{
+    sendToPeers(datagram.constData(), datagram.size());
 }
 
 void GameWindow::readPendingDatagrams()
@@ -1068,28 +1213,35 @@ void GameWindow::processIncomingData(const QByteArray &data, const QHostAddress
             // 자신의 데이터는 무시
             if (playerId == this->playerId) return;
             
-            PlayerData playerData;
-            playerData.playerId = playerId;
-            playerData.x = obj["x"].toInt();
-            playerData.y = obj["y"].toInt();
-            playerData.score = obj["score"].toInt();
-            playerData.gameOver = obj["gameOver"].toBool();
-            playerData.address = sender;
-            playerData.port = port;
-            playerData.lastSeen = QDateTime::currentMSecsSinceEpoch();
-            
-            // 기존 플레이어 업데이트 또는 새 플레이어 추가
-            bool found = false;
+            // 기존 플레이어 업데이트 또는 새 플레이어 추가 (위치 기록은 유지)
+            PlayerData *playerData = nullptr;
             for (int i = 0; i < otherPlayers.size(); ++i) {
                 if (otherPlayers[i].playerId == playerId) {
-                    otherPlayers[i] = playerData;
-                    found = true;
+                    playerData = &otherPlayers[i];
                     break;
                 }
             }
+            const bool found = playerData != nullptr;
+            if (!found) {
+                otherPlayers.append(PlayerData());
+                playerData = &otherPlayers.last();
+                playerData->playerId = playerId;
+            }
+            playerData->x = obj["x"].toInt();
+            playerData->y = obj["y"].toInt();
+            playerData->score = obj["score"].toInt();
+            playerData->gameOver = obj["gameOver"].toBool();
+            playerData->address = sender;
+            playerData->port = port;
+            playerData->lastSeen = QDateTime::currentMSecsSinceEpoch();
+            // 보낸 쪽 타임스탬프 기준으로 기록 (타임스탬프가 없는 패킷은 받은 시각 사용)
+            const qint64 now = remoteClock.elapsed();
+            const qint64 sentAt = obj.contains("timestamp") ? qint64(obj["timestamp"].toDouble()) : now;
+            if (playerData->track.isEmpty())
+                playerData->renderPos = worldToView(QPointF(playerData->x, playerData->y)).toPoint();
+            playerData->track.push(sentAt, QPointF(playerData->x, playerData->y), now);
             
             if (!found) {
-                otherPlayers.append(playerData);
                 qDebug() << "New player joined:" << playerId;
                 
                 // 대기실에서 새 플레이어가 들어오면 게임 시작 조건 확인
@@ -1116,7 +1268,23 @@ void GameWindow::processIncomingData(const QByteArray &data, const QHostAddress
                 isGameStarted = true;
                 isInLobby = false;
                 
-                // 클라이언트는 obstacleTimer를 시작하지 않음 (호스트의 게임 상태를 받아서 동기화)
+                // 클라이언트도 호스트의 월드 크기/레벨 시드/모드/난이도로 같은 장애물을 직접 생성 (장애물 목록을 받지 않음)
+                // 월드 크기가 다르면 생성 위치와 틈 높이 범위가 달라지므로 화면 크기와 무관하게 호스트 값을 씀 (그릴 때 화면에 맞춤)
+                GameSimulation::Config simConfig = simulation.config();
+                if (obj.contains("worldWidth") && obj.contains("worldHeight")) {
+                    simConfig.width = qMax(1, obj["worldWidth"].toInt());
+                    simConfig.height = qMax(1, obj["worldHeight"].toInt());
+                }
+                simConfig.seed = quint32(obj["seed"].toVariant().toLongLong());
+                simConfig.levelMode = LevelGenerator::Mode(obj["levelMode"].toInt());
+                simConfig.scale = LevelGenerator::Scale(obj["scale"].toInt());
+                simConfig.maxInterval = qMax(1, obj["maxInterval"].toInt());
+                simConfig.melody = obj["melody"].toInt();
+                simConfig.difficulty = &DifficultyEngine::profile(obj["difficulty"].toString());
+                simConfig.spawning = true;
+                simulation.reset(simConfig);
+                previousPlayerY = simulation.player().y();
+                simulation.spawnObstacles();
             }
         }
         else if (type == "game_state") {
@@ -1131,7 +1299,7 @@ void GameWindow::broadcastPlayerData()
 {
     if (!isMultiplayerMode || !gameRunning) return;
     
-    updatePlayerPosition(player.x(), player.y(), score, false);
+    updatePlayerPosition(simulation.player().x(), simulation.player().y(), simulation.score(), false);
 }
 
 void GameWindow::cleanupInactivePlayers()
@@ -1165,7 +1333,7 @@ void GameWindow::startLobby()
     }
     
     // 준비 상태 전송
-    updatePlayerPosition(player.x(), player.y(), score, false);
+    updatePlayerPosition(simulation.player().x(), simulation.player().y(), simulation.score(), false);
 }
 
 void GameWindow::leaveLobby()
@@ -1176,7 +1344,7 @@ void GameWindow::leaveLobby()
     isHost = false;
     
     // 게임 종료 상태 전송
-    updatePlayerPosition(player.x(), player.y(), score, true);
+    updatePlayerPosition(simulation.player().x(), simulation.player().y(), simulation.score(), true);
 }
 
 void GameWindow::checkGameStart()
@@ -1203,10 +1371,7 @@ void GameWindow::checkGameStart()
             QJsonDocument doc(startMsg);
             QByteArray datagram = doc.toJson();
             
-            for (int i = 3; i <= 8; ++i) {
-                QHostAddress address(QString("192.168.10.%1").arg(i));
-                udpSocket->writeDatagram(datagram, address, BROADCAST_PORT);
-            }
+            sendToPeers(datagram);
         }
     }
 }
@@ -1224,10 +1389,7 @@ void GameWindow::startGameCountdown()
         QJsonDocument doc(countdownMsg);
         QByteArray datagram = doc.toJson();
         
-        for (int i = 3; i <= 8; ++i) {
-            QHostAddress address(QString("192.168.10.%1").arg(i));
-            udpSocket->writeDatagram(datagram, address, BROADCAST_PORT);
-        }
+        sendToPeers(datagram);
     } else {
         // 게임 시작
         qDebug() << "Game started!";
@@ -1240,28 +1402,28 @@ void GameWindow::startGameCountdown()
             countdownTimer = nullptr;
         }
         
-        // 게임 시작 메시지 전송
+        // 게임 시작 메시지 전송 (월드 크기, 레벨 시드/모드, 난이도 프로파일 포함)
         QJsonObject startMsg;
         startMsg["type"] = "game_started";
+        startMsg["worldWidth"] = simulation.config().width;
+        startMsg["worldHeight"] = simulation.config().height;
+        startMsg["seed"] = qint64(simulation.config().seed);
+        startMsg["levelMode"] = int(simulation.config().levelMode);
+        startMsg["scale"] = int(simulation.config().scale);
+        startMsg["maxInterval"] = simulation.config().maxInterval;
+        startMsg["melody"] = simulation.config().melody;
+        startMsg["difficulty"] = QString::fromLatin1(simulation.difficulty().currentProfile().name);
         
         QJsonDocument doc(startMsg);
         QByteArray datagram = doc.toJson();
         
-        for (int i = 3; i <= 8; ++i) {
-            QHostAddress address(QString("192.168.10.%1").arg(i));
-            udpSocket->writeDatagram(datagram, address, BROADCAST_PORT);
-        }
+        sendToPeers(datagram);
         
-        // 호스트가 첫 번째 장애물 생성
+        // 호스트가 첫 번째 장애물 생성 후 스텝마다 생성 시작 (클라이언트는 game_started를 받으면 같은 시드로 시작)
         if (isHost) {
-            // 호스트의 obstacleTimer 시작
-            if (obstacleTimer && !obstacleTimer->isActive()) {
-                obstacleTimer->start(2000);
-            }
-            spawnObstacles();
+            simulation.setSpawning(true);
+            simulation.spawnObstacles();
         }
-        
-        // 클라이언트는 obstacleTimer를 시작하지 않음 (호스트의 게임 상태를 받아서 동기화)
     }
 }
 
@@ -1269,47 +1431,23 @@ void GameWindow::sendGameState()
 {
     if (!isMultiplayerMode || !udpSocket || !isHost) return;
     
+    // 장애물/별 목록 대신 레벨 시드와 진행 위치만 전송 (클라이언트가 시드로 같은 레벨을 생성)
     QJsonObject gameState;
     gameState["type"] = "game_state";
     gameState["timestamp"] = QDateTime::currentMSecsSinceEpoch();
-    
-    // 장애물 정보
-    QJsonArray obstaclesArray;
-    for (const QRect &obstacle : obstacles) {
-        QJsonObject obstacleObj;
-        obstacleObj["x"] = obstacle.x();
-        obstacleObj["y"] = obstacle.y();
-        obstacleObj["width"] = obstacle.width();
-        obstacleObj["height"] = obstacle.height();
-        obstaclesArray.append(obstacleObj);
-    }
-    gameState["obstacles"] = obstaclesArray;
-    
-    // 별 정보
-    QJsonArray starsArray;
-    for (const Star &star : stars) {
-        if (star.active) {
-            QJsonObject starObj;
-            starObj["x"] = star.pos.x();
-            starObj["y"] = star.pos.y();
-            starsArray.append(starObj);
-        }
-    }
-    gameState["stars"] = starsArray;
+    gameState["seed"] = qint64(simulation.config().seed);
+    gameState["level"] = simulation.level().index();
     
     QJsonDocument doc(gameState);
     QByteArray datagram = doc.toJson();
     
     // 모든 클라이언트에게 전송
-    for (int i = 3; i <= 8; ++i) {
-        QHostAddress address(QString("192.168.10.%1").arg(i));
-        udpSocket->writeDatagram(datagram, address, BROADCAST_PORT);
-    }
+    sendToPeers(datagram);
     
     // 디버그 로그는 10번에 한 번만 출력
     static int logCount = 0;
     if (++logCount % 10 == 0) {
-        qDebug() << "Game state sent - Obstacles:" << obstacles.size() << "Stars:" << stars.size();
+        qDebug() << "Game state sent - Seed:" << simulation.config().seed << "Level:" << simulation.level().index();
     }
 }
 
@@ -1322,33 +1460,12 @@ void GameWindow::processGameState(const QJsonObject &gameState)
     
     lastGameStateUpdate = timestamp;
     
-    // 장애물 동기화
-    obstacles.clear();
-    QJsonArray obstaclesArray = gameState["obstacles"].toArray();
-    for (const QJsonValue &value : obstaclesArray) {
-        QJsonObject obstacleObj = value.toObject();
-        QRect obstacle(
-            obstacleObj["x"].toInt(),
-            obstacleObj["y"].toInt(),
-            obstacleObj["width"].toInt(),
-            obstacleObj["height"].toInt()
-        );
-        obstacles.append(obstacle);
-    }
-    
-    // 별 동기화
-    stars.clear();
-    QJsonArray starsArray = gameState["stars"].toArray();
-    for (const QJsonValue &value : starsArray) {
-        QJsonObject starObj = value.toObject();
-        QPointF pos(starObj["x"].toDouble(), starObj["y"].toDouble());
-        stars.append(Star(pos));
+    // 시드가 다르면 (game_started의 시드를 잘못 받은 경우 등) 호스트의 진행 위치부터 같은 레벨로 이어서 생성
+    const quint32 seed = quint32(gameState["seed"].toVariant().toLongLong());
+    const int level = gameState["level"].toInt();
+    if (isGameStarted && seed != simulation.config().seed) {
+        qDebug() << "Level seed resynced from host:" << seed << "at" << level;
+        simulation.setLevel(seed, level);
+        simulation.setSpawning(true);
     }
-    
-    // 디버그 로그는 10번에 한 번만 출력
-    static int logCount = 0;
-    if (++logCount % 10 == 0) {
-        qDebug() << "Game state received - Obstacles:" << obstacles.size() << "Stars:" << stars.size();
-    }
-
 }
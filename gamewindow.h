@@ -16,6 +16,18 @@
 #include <QStyle>
 #include <QApplication>
 #include "gameoverdialog.h"
+#include "starsprite.h"
+#include "pillarrenderer.h"
+#include "gamescene.h"
+#include "hudlabel.h"
+#include "framescheduler.h"
+#include "renderscaler.h"
+#include "backgroundloader.h"
+#include "snapshotbuffer.h"
+#include "gamesimulation.h"
+#include "collisionmask.h"
+#include <QElapsedTimer>
+#include <QHash>
 #include <QPushButton>
 
 // 멀티플레이어 관련 헤더들
@@ -25,6 +37,8 @@
 #include <QJsonDocument>
 #include <QJsonArray>
 
+class GLGameView;
+
 struct PlayerData {
     QString playerId;
     int x;
@@ -35,6 +49,8 @@ struct PlayerData {
     QHostAddress address;
     quint16 port;
     qint64 lastSeen;
+    SnapshotBuffer track;   // 받은 위치 기록 (보낸 쪽 타임스탬프 기준)
+    QPoint renderPos;       // 이번 프레임에 그릴 위치 (track 보간/추정 결과)
 };
 
 struct GameState {
@@ -44,7 +60,7 @@ struct GameState {
     qint64 timestamp;
 };
 
-class GameWindow : public QMainWindow
+class GameWindow : public QMainWindow, private GameSimulation::Collider
 {
     Q_OBJECT
 
@@ -64,8 +80,9 @@ protected:
     void paintEvent(QPaintEvent *event) override;
 
 private slots:
-    void updateGame();
-    void spawnObstacles();
+    void updateGame();                 // 고정 간격 시뮬레이션 한 스텝
+    void renderFrame(qreal alpha);     // 스텝 사이 보간 렌더링
+    void onBackgroundReady(const QImage &image, const QSize &viewSize);
     void readPitchData();
     void goBackToMainWindow();
     
@@ -78,18 +95,38 @@ private slots:
 private:
     void setupGame();
     void gameOver();
-    bool checkCollision();
-    void startMicProcess();
-    void stopMicProcess();
+    // GameSimulation::Collider - 그려지는 플레이어 스프라이트와 기둥의 마스크로 판정
+    QRect queryRect(const QRect &hitBox) const override;
+    bool collides(const QRect &obstacle, bool topObstacle, const QRect &hitBox) const override;
+    QRect playerSpriteRect(const QRect &hitBox) const;
     void setupBackButton();
 
     void playSound(const QString &soundFile);  // 사운드 재생 도우미 함수
+    void updateReferenceTone();                // 다음 장애물 틈의 기준음 갱신
+    QRegion hudRegion() const;                 // 텍스트 HUD 영역 (부분 갱신용)
+    void scheduleRepaint();                    // 전체/부분 갱신 요청
+    void repaintAll();                         // 전체 갱신 (현재 렌더링 백엔드로)
+    
+    // 렌더링 (래스터/OpenGL 백엔드가 같은 GameScene 사용)
+    void setupRenderBackend();
+    void prepareAssets();
+    void buildScene();
+    QPointF worldToView(const QPointF &point) const;
+    QRect worldToView(const QRect &rect) const;
+    void paintScene(QPainter &painter, qreal scale); // 래스터 백엔드 (scale: 내부 렌더 배율)
+    void paintHud(QPainter &painter);          // 텍스트 HUD (공용)
+    void updateRemotePlayers();
+    void initHudLabels();
+    void updateHudLabels();
+    void updateStatsLabels();
 
     
     // 멀티플레이어 관련 함수들
     void startMultiplayer();
     void stopMultiplayer();
     void updatePlayerPosition(int x, int y, int score, bool gameOver);
+    void sendToPeers(const char *data, int size);     // 192.168.10.3~8 전체에 같은 데이터그램
+    void sendToPeers(const QByteArray &datagram);
     void sendPlayerData();
     void processIncomingData(const QByteArray &data, const QHostAddress &sender, quint16 port);
     void sendGameState();
@@ -99,11 +136,8 @@ private:
     void checkGameStart();
 
 
-    QTimer *gameTimer;
-    QTimer *obstacleTimer;
+    FrameScheduler *frameScheduler;  // 고정 간격 시뮬레이션 + 보간 렌더링
     QTimer *pitchTimer;
-    QProcess *micProcess;
-    QProcess *soundProcess; // 사운드 효과를 위한 프로세스
     QFile *pitchFile;
     QPushButton *backButton;
     
@@ -112,7 +146,10 @@ private:
     QTimer *broadcastTimer;
     QTimer *cleanupTimer;
     QTimer *countdownTimer;
+    GLGameView *glView;        // OpenGL 백엔드 (래스터면 nullptr)
     QString playerId;
+    QByteArray playerIdUtf8;   // player_update 데이터그램용 (한 번만 변환)
+    QVector<QHostAddress> peerAddresses;   // 전송 대상 (생성자에서 한 번만 만듦)
     QList<PlayerData> otherPlayers;
     bool isMultiplayerMode;
     bool isInLobby;
@@ -120,27 +157,25 @@ private:
     bool isHost;
     int countdownValue;
     GameState sharedGameState;
+    QElapsedTimer remoteClock;  // 원격 스냅샷 수신/보간 시각 (단조 증가)
     qint64 lastGameStateUpdate;
     
-    QRect player;
-    QVector<QRect> obstacles;  // QList 대신 QVector 사용
-    struct Star {
-        QPointF pos;
-        bool active;
-        Star(QPointF p) : pos(p), active(true) {}
-    };
-    QVector<Star> stars;  // QList 대신 QVector 사용 (연속 메모리 구조로 성능 향상)
-    int starSize = 60;     // 별 크기
-    QPainterPath starPath; // 캐시된 별 모양
-    
-    // 상수 정의
-    static constexpr int STAR_POINTS = 5;    // 별의 꼭지점 수
-    static constexpr float OUTER_RADIUS = 1.0f;  // 외부 반지름 비율
-    static constexpr float INNER_RADIUS = 0.38f;  // 내부 반지름 비율 (더 뾰족하게)
-    static constexpr float CORNER_SMOOTHNESS = 0.0f; // 모서리 둥글기 제거
+    // 게임 규칙 (플레이어/장애물/별/점수) - 위젯과 무관한 결정적 시뮬레이션, 스텝마다 입력을 넘김
+    GameSimulation simulation;
+    StarSprite starSprite; // 미리 그린 별 스프라이트 아틀라스
+    int starFrames;        // 흔들림 애니메이션 프레임 수 (STAR_FRAMES, 1이면 정지)
+    PillarRenderer pillarRenderer; // 기둥 타일 (몸통 + 캡)
+    BackgroundLoader *backgroundLoader; // 배경 로드/스케일/포맷 변환 (작업 스레드)
+    QPixmap backgroundPixmap;      // 창 크기로 미리 스케일된 배경 (패럴랙스면 창 너비 2배 띠)
+    QSize backgroundSize;          // backgroundPixmap을 만든 창 크기
+    bool parallaxEnabled;          // 배경 패럴랙스 스크롤 (PARALLAX=1)
+    int backgroundScroll;          // 배경 띠 스크롤 위치 (스텝마다 BACKGROUND_SPEED씩)
+    QPixmap spritePixmaps[GameScene::SpriteCount]; // GameScene::SpriteId별 이미지
+    GameScene scene;               // 유지형 장면 (updateGame이 만들고 렌더러가 읽음)
+    RenderScaler renderScaler;     // 내부 렌더 해상도 (RENDER_SCALE, RENDER_SCALE_AUTO)
     
-    int playerSpeed;
-    int score;
+    int previousPlayerY;       // 직전 스텝의 플레이어 위치 (보간용)
+    qreal renderAlpha;         // 마지막 스텝 이후 경과 비율 (0~1)
     bool gameRunning;
     bool moveUp;
     bool moveDown;
@@ -148,18 +183,52 @@ private:
     // 마이크 입력 관련 변수
     int currentPitch;
     float currentVolume;
-    int targetY;
     
     // 플레이어 정보
     QString currentPlayerName;  // 현재 플레이어 이름 저장
     
-    // 게임 요소 크기
-    static const int PLAYER_SIZE = 30;  // 플레이어 크기
-    static const int OBSTACLE_WIDTH = 40;  // 장애물 너비
-
-    static const int OBSTACLE_GAP = 200;  // 장애물 사이 간격
+    // 텍스트 HUD 캐시 (점수/이름/인원/카운트다운이 바뀔 때만 다시 배치)
+    HudLabel scoreLabel;
+    HudLabel playerLabel;
+    HudLabel modeLabel;          // 멀티플레이어 모드 표시
+    HudLabel lobbyTitleLabel;
+    HudLabel lobbyCountLabel;
+    HudLabel lobbyHostLabel;
+    HudLabel countdownLabel;
+    QHash<QString, HudLabel> remoteNameLabels;  // 다른 플레이어 ID
+    int hudScore;                // 마지막으로 배치한 값 (-1이면 미배치)
+    int hudPlayerCount;
+    int hudCountdown;
+    HudLabel pitchLabel;         // 디버그 빌드: 피치/볼륨 (값이 바뀔 때만 다시 배치)
+    HudLabel volumeLabel;
+    int hudPitch;
+    int hudVolume;               // 1/100 단위 (표시 자릿수)
+    
+    // 디버그 통계 오버레이 표시 여부 (F3 토글)
+    bool showStatsOverlay;
+    QVector<HudLabel> statsLabels;   // 오버레이 줄 (STATS_REFRESH_MS마다 다시 만듦)
+    QElapsedTimer statsClock;
+    quint64 lastPaintAllocations;    // 래스터 paintEvent의 장면/HUD 그리기 중 힙 할당 (ALLOCATION_COUNTER 빌드)
+    quint64 maxPaintAllocations;
+    
+    // 기준음 모드 (T 토글): 다음 틈에 맞는 음을 들려줌
+    bool referenceToneEnabled;
+    int referenceScore;
+    
+    // 부분 갱신 모드 (F4 토글): 움직이는 객체의 이전/현재 영역과 HUD만 다시 그림
+    bool partialRepaint;
+    QRegion lastDamage;        // 지난 프레임에 HUD 텍스트를 그린 영역
+    quint64 paintedPixels;     // 채우기 비율 계측 (paintEvent에서 누적)
+    quint64 paintedFrames;
+    int lastPaintedPixels;
+    
+    // 게임 요소 크기/속도는 GameSimulation 기준
+    static const int PLAYER_SIZE = GameSimulation::PLAYER_SIZE;
+    static const int BACKGROUND_SPEED = 1; // 스텝당 배경 스크롤 거리 (장애물보다 느리게)
+    static const int SIMULATION_HZ = GameSimulation::STEP_HZ;   // 시뮬레이션 스텝 빈도 (화면 주사율과 무관)
 
     QPixmap playerImage; // 플레이어 이미지
+    CollisionMask playerMask;  // 그려지는 플레이어 스프라이트(원 대체 포함)의 알파 마스크
 
 //    static const int OBSTACLE_GAP = 300;  // 장애물 사이 간격 (300으로 증가)
     static const int WINDOW_WIDTH = 800;  // 윈도우 너비
@@ -170,7 +239,11 @@ private:
     static const int BROADCAST_INTERVAL = 100; // 100ms
     static const int CLEANUP_INTERVAL = 2000; // 2초
     static const int PLAYER_TIMEOUT = 3000; // 3초
-    static const quint32 FIXED_SEED = 0xDEADBEEF; // 더 복잡한 고정된 랜덤 시드값
+    static const int REMOTE_INTERPOLATION_DELAY = BROADCAST_INTERVAL * 3 / 2; // 패킷 하나가 늦어도 보간 구간 유지
+    static const int PLAYER_UPDATE_SIZE = 256; // player_update 데이터그램 버퍼 (JSON 한 줄)
+    static const int STATS_REFRESH_MS = 500;   // 통계 오버레이 갱신 간격
+
+    char playerUpdateBuffer[PLAYER_UPDATE_SIZE];
 
 };
 
@@ -0,0 +1,224 @@
+#include "glgameview.h"
+#include <QOpenGLContext>
+#include <QOffscreenSurface>
+#include <QPainter>
+#include <QMatrix4x4>
+#include <QDebug>
+
+static const char *vertexShaderSource =
+    "attribute highp vec2 position;\n"
+    "attribute highp vec2 texCoord;\n"
+    "uniform highp mat4 matrix;\n"
+    "varying highp vec2 uv;\n"
+    "void main() {\n"
+    "    uv = texCoord;\n"
+    "    gl_Position = matrix * vec4(position, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *fragmentShaderSource =
+    "uniform sampler2D tex;\n"
+    "varying highp vec2 uv;\n"
+    "void main() {\n"
+    "    gl_FragColor = texture2D(tex, uv);\n"
+    "}\n";
+
+static const int ATLAS_PADDING = 2;  // 인접 이미지 번짐 방지
+
+GLGameView::GLGameView(QWidget *parent)
+    : QOpenGLWidget(parent)
+    , currentScene(nullptr)
+    , backgroundTexture(nullptr)
+    , atlasTexture(nullptr)
+    , texturesDirty(false)
+{
+    // 키 입력은 GameWindow가 처리
+    setFocusPolicy(Qt::NoFocus);
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+}
+
+GLGameView::~GLGameView()
+{
+    makeCurrent();
+    delete backgroundTexture;
+    delete atlasTexture;
+    doneCurrent();
+}
+
+bool GLGameView::hardwareAvailable(QString *rendererName)
+{
+    QOpenGLContext context;
+    if (!context.create())
+        return false;
+    QOffscreenSurface surface;
+    surface.setFormat(context.format());
+    surface.create();
+    if (!surface.isValid() || !context.makeCurrent(&surface))
+        return false;
+
+    const GLubyte *renderer = context.functions()->glGetString(GL_RENDERER);
+    const QString name = renderer ? QString::fromLatin1(reinterpret_cast<const char *>(renderer)) : QString();
+    context.doneCurrent();
+    if (rendererName)
+        *rendererName = name;
+
+    // CI의 Mesa llvmpipe 같은 소프트웨어 렌더러는 래스터보다 느리므로 제외
+    const QString lower = name.toLower();
+    return !name.isEmpty() && !lower.contains("llvmpipe") && !lower.contains("softpipe") && !lower.contains("software");
+}
+
+// 아틀라스는 CPU에서 한 줄로 나란히 배치해 두고 다음 paintGL에서 텍스처로 올림
+void GLGameView::setAssets(const QPixmap &background, const QPixmap *sprites)
+{
+    backgroundImage = background.isNull() ? QImage() : background.toImage();
+
+    QImage images[GameScene::SpriteCount];
+    int width = 0;
+    int height = 1;
+    for (int i = 0; i < GameScene::SpriteCount; ++i) {
+        images[i] = sprites[i].toImage();
+        images[i].setDevicePixelRatio(1.0);  // 아틀라스는 실제 픽셀 단위
+        atlasRects[i] = QRect(width, 0, images[i].width(), images[i].height());
+        width += images[i].width() + ATLAS_PADDING;
+        height = qMax(height, images[i].height());
+    }
+
+    atlasImage = QImage(qMax(1, width), height, QImage::Format_ARGB32_Premultiplied);
+    atlasImage.fill(Qt::transparent);
+    QPainter painter(&atlasImage);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    for (int i = 0; i < GameScene::SpriteCount; ++i) {
+        if (!images[i].isNull())
+            painter.drawImage(atlasRects[i].topLeft(), images[i]);
+    }
+    painter.end();
+
+    texturesDirty = true;
+    qDebug() << "GLGameView: atlas" << atlasImage.size();
+}
+
+void GLGameView::initializeGL()
+{
+    initializeOpenGLFunctions();
+    program.addShaderFromSourceCode(QOpenGLShader::Vertex, vertexShaderSource);
+    program.addShaderFromSourceCode(QOpenGLShader::Fragment, fragmentShaderSource);
+    program.bindAttributeLocation("position", 0);
+    program.bindAttributeLocation("texCoord", 1);
+    if (!program.link())
+        qDebug() << "GLGameView: shader link failed" << program.log();
+    qDebug() << "GLGameView: renderer" << reinterpret_cast<const char *>(glGetString(GL_RENDERER));
+}
+
+void GLGameView::uploadTextures()
+{
+    texturesDirty = false;
+    delete backgroundTexture;
+    delete atlasTexture;
+    backgroundTexture = nullptr;
+    atlasTexture = nullptr;
+
+    if (!backgroundImage.isNull())
+        backgroundTexture = new QOpenGLTexture(backgroundImage, QOpenGLTexture::DontGenerateMipMaps);
+    if (!atlasImage.isNull()) {
+        atlasTexture = new QOpenGLTexture(atlasImage, QOpenGLTexture::DontGenerateMipMaps);
+        // 1:1로 그리므로 보간 없이 픽셀 그대로
+        atlasTexture->setMinMagFilters(QOpenGLTexture::Nearest, QOpenGLTexture::Nearest);
+        atlasTexture->setWrapMode(QOpenGLTexture::ClampToEdge);
+    }
+}
+
+// source는 아틀라스 픽셀 좌표
+void GLGameView::addQuad(QVector<Vertex> &batch, const QRectF &target, const QRectF &source)
+{
+    const GLfloat w = GLfloat(atlasImage.width());
+    const GLfloat h = GLfloat(atlasImage.height());
+    const GLfloat x0 = GLfloat(target.left()), y0 = GLfloat(target.top());
+    const GLfloat x1 = GLfloat(target.left() + target.width()), y1 = GLfloat(target.top() + target.height());
+    const GLfloat u0 = GLfloat(source.left()) / w, v0 = GLfloat(source.top()) / h;
+    const GLfloat u1 = GLfloat(source.left() + source.width()) / w, v1 = GLfloat(source.top() + source.height()) / h;
+    const Vertex quad[6] = {
+        { x0, y0, u0, v0 }, { x1, y0, u1, v0 }, { x0, y1, u0, v1 },
+        { x1, y0, u1, v0 }, { x1, y1, u1, v1 }, { x0, y1, u0, v1 }
+    };
+    for (const Vertex &v : quad)
+        batch.append(v);
+}
+
+// 배경 텍스처의 [sourceX, sourceX + w) 열을 화면 x 위치에 1:1로 그림
+void GLGameView::addBackgroundQuad(QVector<Vertex> &batch, int x, int sourceX, int w)
+{
+    const GLfloat tw = GLfloat(backgroundImage.width());
+    const GLfloat x0 = GLfloat(x), x1 = GLfloat(x + w), y1 = GLfloat(height());
+    const GLfloat u0 = sourceX / tw, u1 = (sourceX + w) / tw;
+    const Vertex quad[6] = {
+        { x0, 0, u0, 0 }, { x1, 0, u1, 0 }, { x0, y1, u0, 1 },
+        { x1, 0, u1, 0 }, { x1, y1, u1, 1 }, { x0, y1, u0, 1 }
+    };
+    for (const Vertex &v : quad)
+        batch.append(v);
+}
+
+void GLGameView::drawBatch(QOpenGLTexture *texture, QVector<Vertex> &batch)
+{
+    if (!texture || batch.isEmpty()) return;
+    texture->bind(0);
+    const Vertex *data = batch.constData();
+    program.setAttributeArray(0, GL_FLOAT, &data->x, 2, sizeof(Vertex));
+    program.setAttributeArray(1, GL_FLOAT, &data->u, 2, sizeof(Vertex));
+    glDrawArrays(GL_TRIANGLES, 0, batch.size());
+    batch.resize(0);
+}
+
+void GLGameView::paintGL()
+{
+    if (texturesDirty)
+        uploadTextures();
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    if (currentScene && atlasTexture && program.isLinked()) {
+        QMatrix4x4 matrix;
+        matrix.ortho(0, width(), height(), 0, -1, 1);
+        program.bind();
+        program.setUniformValue("matrix", matrix);
+        program.setUniformValue("tex", 0);
+        program.enableAttributeArray(0);
+        program.enableAttributeArray(1);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        // 배경: 화면 크기로 미리 스케일된 텍스처 (패럴랙스 띠면 스크롤 위치에서 잘라 그리고 끝에서 처음으로 이어 붙임)
+        if (backgroundTexture) {
+            const int textureWidth = backgroundImage.width();
+            const int offset = currentScene->backgroundOffset() % textureWidth;
+            const int first = qMin(textureWidth - offset, width());
+            addBackgroundQuad(batch, 0, offset, first);
+            if (first < width())
+                addBackgroundQuad(batch, first, 0, width() - first);
+            drawBatch(backgroundTexture, batch);
+        }
+
+        // 그리기 항목은 레이어 → 스프라이트 순으로 정렬되어 있으므로 레이어가 바뀔 때만 draw call
+        const QVector<GameScene::DrawItem> &items = currentScene->items();
+        int layer = items.isEmpty() ? 0 : items.first().layer;
+        for (const GameScene::DrawItem &item : items) {
+            if (item.layer != layer) {
+                drawBatch(atlasTexture, batch);
+                layer = item.layer;
+            }
+            addQuad(batch, QRectF(item.target), QRectF(item.source.translated(atlasRects[item.sprite].topLeft())));
+        }
+        drawBatch(atlasTexture, batch);
+
+        glDisable(GL_BLEND);
+        program.disableAttributeArray(0);
+        program.disableAttributeArray(1);
+        program.release();
+    }
+
+    // 텍스트 HUD는 QPainter로 위에 그림
+    if (hudPainter) {
+        QPainter painter(this);
+        hudPainter(painter);
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef GLGAMEVIEW_H
+#define GLGAMEVIEW_H
+
+#include <QOpenGLWidget>
+#include <QOpenGLFunctions>
+#include <QOpenGLShaderProgram>
+#include <QOpenGLTexture>
+#include <QImage>
+#include <QVector>
+#include <functional>
+#include "gamescene.h"
+
+// OpenGL 렌더링 백엔드
+// 래스터 백엔드와 같은 GameScene 그리기 항목을 텍스처 사각형으로 그림
+// 스프라이트(기둥 타일/캡, 별, 플레이어)는 하나의 아틀라스 텍스처에 모아 레이어당 draw call 1번으로 처리
+// 텍스트 HUD는 GL 그리기 후 같은 위젯 위에 QPainter로 그림
+class GLGameView : public QOpenGLWidget, protected QOpenGLFunctions
+{
+    Q_OBJECT
+
+public:
+    explicit GLGameView(QWidget *parent = nullptr);
+    ~GLGameView();
+
+    // 하드웨어 GL 사용 가능 여부 (llvmpipe 등 소프트웨어 렌더러면 false)
+    static bool hardwareAvailable(QString *rendererName = nullptr);
+
+    void setScene(const GameScene *scene) { currentScene = scene; }
+    void setHudPainter(const std::function<void(QPainter &)> &painter) { hudPainter = painter; }
+    // 에셋이 바뀌면 다음 프레임에 아틀라스를 다시 올림
+    // sprites는 GameScene::SpriteId 순서의 SpriteCount개 배열
+    void setAssets(const QPixmap &background, const QPixmap *sprites);
+
+protected:
+    void initializeGL() override;
+    void paintGL() override;
+
+private:
+    struct Vertex {
+        GLfloat x, y, u, v;
+    };
+    void uploadTextures();
+    void addQuad(QVector<Vertex> &batch, const QRectF &target, const QRectF &source);
+    void addBackgroundQuad(QVector<Vertex> &batch, int x, int sourceX, int w);
+    void drawBatch(QOpenGLTexture *texture, QVector<Vertex> &batch);
+
+    const GameScene *currentScene;
+    std::function<void(QPainter &)> hudPainter;
+
+    QOpenGLShaderProgram program;
+    QOpenGLTexture *backgroundTexture;
+    QOpenGLTexture *atlasTexture;
+    QImage backgroundImage;
+    QImage atlasImage;
+    QRect atlasRects[GameScene::SpriteCount];   // 아틀라스 내 스프라이트 위치 (픽셀)
+    bool texturesDirty;
+
+    // 정점 배열 (용량 유지, 프레임마다 재할당 없음)
+    QVector<Vertex> batch;
+};
+
+#endif // GLGAMEVIEW_H
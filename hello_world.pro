@@ -4,7 +4,7 @@
 #
 #-------------------------------------------------
 
-QT       += core gui widgets network
+QT       += core gui widgets network concurrent
 
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
@@ -18,16 +18,65 @@ SOURCES += main.cpp\
         gamewindow.cpp\
         gameoverdialog.cpp\
         rankingdialog.cpp\
-        playerdialog.cpp
+        playerdialog.cpp\
+        audioengine.cpp\
+        audiostream.cpp\
+        wavetable.c\
+        starsprite.cpp\
+        pillarrenderer.cpp\
+        gamescene.cpp\
+        hudlabel.cpp\
+        framescheduler.cpp\
+        renderscaler.cpp\
+        backgroundloader.cpp\
+        snapshotbuffer.cpp\
+        entitystore.cpp\
+        collisionmask.cpp\
+        gamesimulation.cpp\
+        levelgenerator.cpp\
+        difficultyengine.cpp\
+        allocationcounter.cpp
 
 HEADERS  += mainwindow.h\
         gameoverdialog.h\
         gamewindow.h\
         rankingdialog.h\
-        playerdialog.h
+        playerdialog.h\
+        audioengine.h\
+        echoref.h\
+        audiostream.h\
+        wavetable.h\
+        starsprite.h\
+        pillarrenderer.h\
+        gamescene.h\
+        hudlabel.h\
+        framescheduler.h\
+        renderscaler.h\
+        backgroundloader.h\
+        snapshotbuffer.h\
+        ringbuffer.h\
+        entitystore.h\
+        collisionmask.h\
+        gamesimulation.h\
+        levelgenerator.h\
+        difficultyengine.h\
+        allocationcounter.h
 
 FORMS    += mainwindow.ui
 
+# OpenGL 렌더링 백엔드 (Qt가 OpenGL 지원으로 빌드된 경우만, 실행 시 RENDER_BACKEND=gl로 선택)
+contains(QT_CONFIG, opengl)|contains(QT_CONFIG, opengles2) {
+    SOURCES += glgameview.cpp
+    HEADERS += glgameview.h
+    DEFINES += GAME_GL_BACKEND
+}
+
+# 디버그 빌드: 힙 할당 계측 (통계 오버레이의 틱/그리기당 할당 횟수)
+CONFIG(debug, debug|release): DEFINES += ALLOCATION_COUNTER
+
+# 오디오 엔진 (ALSA 직접 출력)
+unix: LIBS += -lasound -lrt
+
 DISTFILES += \
 #    main.qml
 
@@ -0,0 +1,52 @@
+#include "hudlabel.h"
+#include <QFontMetrics>
+#include <QTransform>
+#include <QtMath>
+
+HudLabel::HudLabel()
+    : ascent(0)
+    , textWidth(0)
+    , textHeight(0)
+{
+    staticText.setTextFormat(Qt::PlainText);
+    staticText.setPerformanceHint(QStaticText::AggressiveCaching);
+}
+
+void HudLabel::setFont(const QFont &newFont)
+{
+    if (font == newFont) return;
+    font = newFont;
+    relayout();
+}
+
+bool HudLabel::setText(const QString &text)
+{
+    if (text == source) return false;
+    source = text;
+    relayout();
+    return true;
+}
+
+void HudLabel::relayout()
+{
+    const QFontMetrics fm(font);
+    ascent = fm.ascent();
+    textHeight = fm.height();
+    staticText.setText(source);
+    // HUD는 변환 없이 그리므로 단위 변환 기준으로 글리프 위치를 미리 계산
+    staticText.prepare(QTransform(), font);
+    textWidth = qCeil(staticText.size().width());
+}
+
+void HudLabel::draw(QPainter &painter, int x, int baseline, Align align) const
+{
+    if (source.isEmpty()) return;
+    if (align == AlignRight)
+        x -= textWidth;
+    else if (align == AlignCenter)
+        x -= textWidth / 2;
+    // 폰트가 다르면 QStaticText가 다시 배치하므로 그리기 전에 맞춰 둠
+    if (painter.font() != font)
+        painter.setFont(font);
+    painter.drawStaticText(x, baseline - ascent, staticText);
+}
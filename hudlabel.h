@@ -0,0 +1,42 @@
+#ifndef HUDLABEL_H
+#define HUDLABEL_H
+
+#include <QStaticText>
+#include <QFont>
+#include <QString>
+#include <QPainter>
+
+// 미리 배치(shaping)해 둔 HUD 텍스트 한 줄
+// 문자열이 바뀔 때만 QStaticText를 다시 배치하고, 매 프레임에는 배치된 글리프만 그림
+class HudLabel
+{
+public:
+    enum Align { AlignLeft, AlignRight, AlignCenter };
+
+    HudLabel();
+
+    void setFont(const QFont &font);
+    // 같은 문자열이면 아무 것도 하지 않음 (다시 배치했으면 true)
+    bool setText(const QString &text);
+
+    const QString &text() const { return source; }
+    int width() const { return textWidth; }
+    int height() const { return textHeight; }
+    bool isEmpty() const { return source.isEmpty(); }
+
+    // (x, baseline) 기준은 QPainter::drawText(int, int, QString)과 같음
+    // AlignRight면 x가 오른쪽 끝, AlignCenter면 가운데
+    void draw(QPainter &painter, int x, int baseline, Align align = AlignLeft) const;
+
+private:
+    void relayout();
+
+    QFont font;
+    QString source;
+    QStaticText staticText;
+    int ascent;
+    int textWidth;
+    int textHeight;
+};
+
+#endif // HUDLABEL_H
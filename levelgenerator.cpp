@@ -0,0 +1,180 @@
+#include "levelgenerator.h"
+
+// 음계: 으뜸음 기준 반음 위치 비트 (0번 비트 = 으뜸음)
+static const quint16 scaleMasks[] = {
+    0x0FFF,     // Chromatic
+    0x0AB5,     // Major (0 2 4 5 7 9 11)
+    0x05AD,     // Minor (0 2 3 5 7 8 10)
+    0x0295      // Pentatonic (0 2 4 7 9)
+};
+
+// 내장 멜로디 (으뜸음 기준 반음 간격)
+struct MelodyData {
+    const char *name;
+    const qint8 *offsets;
+    int length;
+};
+
+static const qint8 odeToJoy[] = { 4, 4, 5, 7, 7, 5, 4, 2, 0, 0, 2, 4, 4, 2, 2,
+                                  4, 4, 5, 7, 7, 5, 4, 2, 0, 0, 2, 4, 2, 0, 0 };
+static const qint8 twinkle[] = { 0, 0, 7, 7, 9, 9, 7, 5, 5, 4, 4, 2, 2, 0,
+                                 7, 7, 5, 5, 4, 4, 2, 7, 7, 5, 5, 4, 4, 2 };
+static const qint8 scalePractice[] = { 0, 2, 4, 5, 7, 9, 11, 12, 11, 9, 7, 5, 4, 2 };
+
+static const MelodyData melodies[] = {
+    { "ode-to-joy", odeToJoy, int(sizeof(odeToJoy)) },
+    { "twinkle", twinkle, int(sizeof(twinkle)) },
+    { "scale", scalePractice, int(sizeof(scalePractice)) }
+};
+
+LevelGenerator::LevelGenerator()
+    : generated(0)
+    , consumed(0)
+    , previousCenter(0)
+    , previousGap(0)
+{
+    reset(Config());
+}
+
+void LevelGenerator::reset(const Config &config)
+{
+    settings = config;
+    random.reseed(config.seed);
+    upcoming.clear();
+    generated = 0;
+    consumed = 0;
+    previousCenter = config.height / 2;     // 플레이어 시작 높이
+    previousGap = config.startGap;
+    generateChunk();
+    generateChunk();
+}
+
+void LevelGenerator::seek(int index)
+{
+    reset(settings);
+    while (consumed < index)
+        next();
+}
+
+QVector<LevelPiece> LevelGenerator::song(int count) const
+{
+    LevelGenerator preview;
+    preview.reset(settings);
+    QVector<LevelPiece> pieces;
+    pieces.reserve(count);
+    for (int i = 0; i < count; ++i)
+        pieces.append(preview.next());
+    return pieces;
+}
+
+int LevelGenerator::melodyCount()
+{
+    return int(sizeof(melodies) / sizeof(melodies[0]));
+}
+
+const char *LevelGenerator::melodyName(int melody)
+{
+    return melodies[qBound(0, melody, melodyCount() - 1)].name;
+}
+
+LevelPiece LevelGenerator::next()
+{
+    const LevelPiece piece = upcoming.first();
+    upcoming.removeFirst();
+    ++consumed;
+    // 남은 쌍이 한 청크 이하가 되면 다음 청크를 미리 만듦 (peek 범위 유지)
+    if (upcoming.size() <= CHUNK_SIZE)
+        generateChunk();
+    return piece;
+}
+
+void LevelGenerator::generateChunk()
+{
+    for (int i = 0; i < CHUNK_SIZE; ++i)
+        upcoming.append(generatePiece(generated++));
+}
+
+LevelPiece LevelGenerator::generatePiece(int pieceIndex)
+{
+    const Config &c = settings;
+    LevelPiece piece;
+    const int gap = qMax(c.minGap, c.startGap - pieceIndex * c.gapShrink);
+    piece.gapSize = qBound(c.playerSize, gap, qMax(c.playerSize, c.height));
+
+    // 틈이 화면 안에 있고 위/아래 장애물이 최소 높이를 갖도록 (화면이 작으면 여유를 줄이고, 그래도 안 되면 중앙)
+    int minCenter = piece.gapSize / 2 + c.playerSize + c.edgeMargin;
+    int maxCenter = c.height - piece.gapSize / 2 - c.playerSize - c.edgeMargin;
+    if (minCenter >= maxCenter) {
+        minCenter = piece.gapSize / 2 + c.edgeMargin;
+        maxCenter = c.height - piece.gapSize / 2 - c.edgeMargin;
+    }
+    if (minCenter > maxCenter)
+        minCenter = maxCenter = c.height / 2;
+
+    // 직전 틈에서 움직일 수 있는 거리: 두 쌍 사이 이동 거리 + 각 틈 안에서의 여유
+    const int reachable = c.travel + (previousGap - c.playerSize) / 2 + (piece.gapSize - c.playerSize) / 2;
+    const int jump = qMin(c.startJump + pieceIndex * c.jumpGrowth, reachable);
+    const int lowest = qBound(minCenter, previousCenter - jump, maxCenter);
+    const int highest = qBound(minCenter, previousCenter + jump, maxCenter);
+
+    if (c.mode != RandomGaps && c.noteToY) {
+        piece.note = c.mode == Melody ? melodyNote(pieceIndex, minCenter, maxCenter)
+                                      : scaleNote(minCenter, maxCenter, jump);
+    }
+    if (piece.note > 0)
+        piece.gapCenter = qBound(minCenter, noteCenter(piece.note), maxCenter);
+    else
+        piece.gapCenter = random.bounded(lowest, highest);
+    piece.star = int(random.bounded(100u)) < c.starChance;
+
+    previousCenter = piece.gapCenter;
+    previousGap = piece.gapSize;
+    return piece;
+}
+
+// 그 음을 낼 때 플레이어 히트박스 중앙 높이
+int LevelGenerator::noteCenter(int note) const
+{
+    return settings.noteToY(note, settings.height) + settings.playerSize / 2;
+}
+
+// 음계 안의 음 중 직전 틈에서 maxInterval도 이내, 도달 가능한 거리 안의 음을 고름
+int LevelGenerator::scaleNote(int minCenter, int maxCenter, int jump)
+{
+    const Config &c = settings;
+    const quint16 mask = scaleMasks[qBound(0, int(c.scale), 3)];
+    int notes[37];
+    int count = 0;
+    for (int note = qMax(1, c.lowNote); note <= qMin(37, c.highNote); ++note) {
+        const int degree = ((note - c.rootNote) % 12 + 12) % 12;
+        const int center = noteCenter(note);
+        if ((mask >> degree & 1) && center >= minCenter && center <= maxCenter)
+            notes[count++] = note;
+    }
+    if (count == 0) return 0;   // 화면이 너무 작음 → 픽셀 공간으로
+
+    // 직전 틈에 가장 가까운 음에서 출발 (첫 쌍은 화면 중앙)
+    int current = 0;
+    for (int i = 1; i < count; ++i) {
+        if (qAbs(noteCenter(notes[i]) - previousCenter) < qAbs(noteCenter(notes[current]) - previousCenter))
+            current = i;
+    }
+    int lowest = qMax(0, current - c.maxInterval);
+    int highest = qMin(count - 1, current + c.maxInterval);
+    while (lowest < current && qAbs(noteCenter(notes[lowest]) - previousCenter) > jump) ++lowest;
+    while (highest > current && qAbs(noteCenter(notes[highest]) - previousCenter) > jump) --highest;
+    return notes[random.bounded(lowest, highest)];
+}
+
+// 멜로디의 다음 음 (음역/화면 밖이면 옥타브 단위로 접음, 피치 점수가 클수록 위쪽)
+int LevelGenerator::melodyNote(int pieceIndex, int minCenter, int maxCenter) const
+{
+    const Config &c = settings;
+    const MelodyData &m = melodies[qBound(0, c.melody, melodyCount() - 1)];
+    int note = c.rootNote + m.offsets[pieceIndex % m.length];
+    for (int i = 0; i < 3 && (note > qMin(37, c.highNote) || noteCenter(note) < minCenter); ++i)
+        note -= 12;
+    for (int i = 0; i < 3 && (note < qMax(1, c.lowNote) || noteCenter(note) > maxCenter); ++i)
+        note += 12;
+    return qBound(1, note, 37);
+}
@@ -0,0 +1,151 @@
+#ifndef LEVELGENERATOR_H
+#define LEVELGENERATOR_H
+
+#include <QVector>
+#include <QtGlobal>
+#include "ringbuffer.h"
+
+// PCG32 (XSH-RR) 난수 스트림
+// 매치마다 시드 하나로 시작해 순서대로만 뽑으므로 같은 시드면 어느 보드에서나 같은 수열
+// 상태 16바이트, 할당 없음, 플랫폼/Qt 버전과 무관한 결과 (QRandomGenerator는 구현이 바뀔 수 있음)
+class Pcg32
+{
+public:
+    explicit Pcg32(quint64 seed = 0) { reseed(seed); }
+
+    void reseed(quint64 seed)
+    {
+        state = 0;
+        next();
+        state += seed;
+        next();
+    }
+
+    quint32 next()
+    {
+        const quint64 old = state;
+        state = old * 6364136223846793005ULL + INCREMENT;
+        const quint32 xorshifted = quint32(((old >> 18) ^ old) >> 27);
+        const quint32 rot = quint32(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+
+    // [0, bound) 균등 분포 (치우침 없는 거절 샘플링)
+    quint32 bounded(quint32 bound)
+    {
+        if (bound <= 1) return 0;
+        const quint32 threshold = (0u - bound) % bound;
+        for (;;) {
+            const quint32 value = next();
+            if (value >= threshold) return value % bound;
+        }
+    }
+
+    // [lowest, highest] (양 끝 포함, 범위가 비어 있으면 lowest)
+    int bounded(int lowest, int highest)
+    {
+        if (highest <= lowest) return lowest;
+        return lowest + int(bounded(quint32(highest - lowest) + 1));
+    }
+
+private:
+    static const quint64 INCREMENT = 1442695040888963407ULL;
+    quint64 state;
+};
+
+// 장애물 한 쌍 (틈 중앙/크기, 별 여부, 음 모드면 틈에 해당하는 피치 점수)
+struct LevelPiece {
+    int gapCenter;
+    int gapSize;
+    int note;           // 1~37 (A2~A5), RandomGaps 모드는 0
+    bool star;
+
+    LevelPiece() : gapCenter(0), gapSize(0), note(0), star(false) {}
+};
+
+// 매치 레벨 생성기
+// 시드 하나의 PCG32 스트림에서 장애물 쌍을 순서대로 만들고, 앞으로 나올 쌍을 청크 단위로 미리 만들어 둠
+// → 생성 순서가 화면의 장애물 수/제거 시점과 무관, 멀티플레이어 클라이언트는 시드만으로 같은 레벨을 재생성
+// 난이도 곡선: 쌍 번호에 따라 틈이 좁아지고 이웃 틈 사이 높이 변화가 커짐
+// 높이 변화는 항상 플레이어가 두 쌍 사이에서 움직일 수 있는 거리(travel) 안으로 제한 (도달 불가능한 틈 없음)
+// 음 모드: 틈을 픽셀이 아닌 음(피치 점수)으로 골라 게임과 같은 피치 → y 변환으로 배치 (틈 = 불러야 할 음)
+class LevelGenerator
+{
+public:
+    static const int CHUNK_SIZE = 16;    // 한 번에 미리 만드는 쌍 수 (peek 가능한 범위)
+
+    enum Mode {
+        RandomGaps,     // 틈 높이를 픽셀 공간에서 균등하게
+        ScaleWalk,      // 음계 위를 maxInterval도 이내로 무작위 이동
+        Melody          // 내장 멜로디를 순서대로 (음역 밖의 음은 옥타브 단위로 접음, 높이 변화 제한 없음)
+    };
+    enum Scale { Chromatic, Major, Minor, Pentatonic };
+
+    struct Config {
+        int height;
+        quint32 seed;
+        int playerSize;     // 틈이 이보다 좁아지지 않음
+        int edgeMargin;     // 위/아래 장애물의 최소 높이 (플레이어 크기에 더해서)
+        int travel;         // 이웃한 두 쌍 사이에서 플레이어가 움직일 수 있는 세로 거리
+        int starChance;     // 쌍마다 별이 생길 확률 (%)
+
+        // 난이도 곡선 (쌍 번호에 비례, 한계값에서 멈춤)
+        int startGap;
+        int minGap;
+        int gapShrink;      // 쌍마다 줄어드는 틈 크기
+        int startJump;      // 첫 쌍들의 최대 높이 변화
+        int jumpGrowth;     // 쌍마다 늘어나는 최대 높이 변화 (travel이 상한)
+
+        // 음 모드
+        Mode mode;
+        Scale scale;
+        int rootNote;       // 음계/멜로디의 으뜸음 (피치 점수, 16 = C4)
+        int lowNote;        // 부르기 편한 음역
+        int highNote;
+        int maxInterval;    // ScaleWalk: 이웃한 틈 사이 최대 음계 간격 (도 단위)
+        int melody;         // Melody: 내장 멜로디 번호 (melodyName)
+        int (*noteToY)(int note, int height);  // 피치 점수 → 플레이어 y (게임의 변환을 그대로, 없으면 RandomGaps)
+
+        Config()
+            : height(1080), seed(0), playerSize(30), edgeMargin(50), travel(480), starChance(30)
+            , startGap(200), minGap(140), gapShrink(2), startJump(200), jumpGrowth(10)
+            , mode(RandomGaps), scale(Major), rootNote(16), lowNote(4), highNote(33), maxInterval(2), melody(0)
+            , noteToY(nullptr) {}
+    };
+
+    LevelGenerator();
+
+    void reset(const Config &config);
+    // 처음부터 index번째 쌍 직전까지 다시 만들어 건너뜀 (늦게 들어온 클라이언트용)
+    void seek(int index);
+
+    LevelPiece next();
+    // 다음에 나올 쌍 (ahead < CHUNK_SIZE)
+    const LevelPiece &peek(int ahead = 0) const { return upcoming[ahead]; }
+
+    const Config &config() const { return settings; }
+    int index() const { return consumed; }     // 지금까지 꺼낸 쌍 수
+
+    // 처음부터 count쌍을 미리 만듦 (지금 진행 위치와 무관, 곡 전체/피치 트랙 계산용)
+    QVector<LevelPiece> song(int count) const;
+
+    static int melodyCount();
+    static const char *melodyName(int melody);
+
+private:
+    void generateChunk();
+    LevelPiece generatePiece(int pieceIndex);
+    int noteCenter(int note) const;
+    int scaleNote(int minCenter, int maxCenter, int jump);
+    int melodyNote(int pieceIndex, int minCenter, int maxCenter) const;
+
+    Config settings;
+    Pcg32 random;
+    RingBuffer<LevelPiece, CHUNK_SIZE * 2> upcoming;
+    int generated;
+    int consumed;
+    int previousCenter;
+    int previousGap;
+};
+
+#endif // LEVELGENERATOR_H
@@ -1,5 +1,6 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
+#include "audioengine.h"
 #include <QMessageBox>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -15,6 +16,7 @@
 #include <QTimer>
 #include <QStyle>
 #include <QThread>
+#include <QFile>
 
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
@@ -28,7 +30,6 @@ MainWindow::MainWindow(QWidget *parent) :
     playerDialog(nullptr),
     currentPlayerLabel(nullptr),  // 현재 플레이어 라벨 초기화
     backgroundMusicEnabled(true),  // 배경 음악 기본값은 켜기
-    backgroundMusicProcess(nullptr), // 배경음악 프로세스 초기화
     volumeLevel(50),  // 볼륨 기본값 50%
     isCreatingGameWindow(false),
     gameWindowCreationTimer(nullptr)
@@ -141,7 +142,7 @@ MainWindow::MainWindow(QWidget *parent) :
     // 배경 음악이 활성화되어 있으면 시작
     if (backgroundMusicEnabled) {
         QTimer::singleShot(500, this, [this]() {
-            controlBackgroundMusicProcess(true);
+            controlBackgroundMusic(true);
         });
     }
 }
@@ -155,16 +156,10 @@ MainWindow::~MainWindow()
         gameWindowCreationTimer = nullptr;
     }
     
-    // 배경 음악 프로세스 정리
-    if (backgroundMusicProcess) {
-        backgroundMusicProcess->terminate();
-        backgroundMusicProcess->waitForFinished(1000);
-        delete backgroundMusicProcess;
-        backgroundMusicProcess = nullptr;
-        
-        // 실행 중인 aplay 프로세스 종료
-        QProcess::execute("killall", QStringList() << "-9" << "aplay");
-    }
+    // 오디오 엔진 종료 (오디오 스레드는 한 주기 안에 장치 버퍼를 버리고 장치를 닫음)
+    // 버퍼 뒤에 쌓일 배경 음악 페이드아웃은 재생되지 않으므로 요청하지 않음
+    AudioEngine::instance()->shutdown();
+    AudioEngine::instance()->waitForShutdown();
     
     // 게임 윈도우 정리
     cleanupGameWindow();
@@ -198,7 +193,7 @@ void MainWindow::initAudio()
     // 초기 배경 음악 시작
     if (backgroundMusicEnabled) {
         QTimer::singleShot(500, this, [this]() {
-            controlBackgroundMusicProcess(true);
+            controlBackgroundMusic(true);
         });
     }
 }
@@ -297,7 +292,7 @@ void MainWindow::createSettingsDialog()
                backgroundMusicEnabled ? "#1e8449" : "#a93226")); // 눌렸을 때 색상
         
         // 실제 배경 음악 제어 코드 실행
-        controlBackgroundMusicProcess(backgroundMusicEnabled);
+        controlBackgroundMusic(backgroundMusicEnabled);
         qDebug() << "Background music:" << (backgroundMusicEnabled ? "ON" : "OFF");
     });
 
@@ -793,46 +788,18 @@ void MainWindow::updateCurrentPlayerDisplay()
     updateButtonPositions();
 }
 
-// 리눅스 명령어로 배경 음악 프로세스 제어
-void MainWindow::controlBackgroundMusicProcess(bool start)
+// 오디오 엔진으로 배경 음악 제어 (aplay 프로세스 대신 믹서의 음악 채널 사용)
+void MainWindow::controlBackgroundMusic(bool start)
 {
     qDebug() << "Background music control:" << (start ? "START" : "STOP");
 
-    // 기존 프로세스 종료
-    if (backgroundMusicProcess != nullptr) {
-        qDebug() << "Terminating existing background music process...";
-        backgroundMusicProcess->terminate();
-        backgroundMusicProcess->waitForFinished(1000);
-        delete backgroundMusicProcess;
-        backgroundMusicProcess = nullptr;
-        QProcess::execute("killall", QStringList() << "-9" << "aplay");
-        qDebug() << "Background music process terminated.";
-    }
-
     if (start) {
-        qDebug() << "Starting background music...";
-        backgroundMusicProcess = new QProcess(this);
-        backgroundMusicProcess->start("./aplay", QStringList() << "-Dhw:0,0" << "/mnt/nfs/wav/background.wav");
-        
-        if (backgroundMusicProcess->waitForStarted(1000)) {
-            qDebug() << "Background music started with aplay.";
-        } else {
-            qDebug() << "Failed to start background music. Trying absolute path...";
-            delete backgroundMusicProcess;
-            
-            // 절대 경로로 시도
-            backgroundMusicProcess = new QProcess(this);
-            backgroundMusicProcess->start("/usr/bin/aplay", QStringList() << "-Dhw:0,0" << "/mnt/nfs/wav/background.wav");
-            
-            if (backgroundMusicProcess->waitForStarted(1000)) {
-                qDebug() << "Background music started with absolute path aplay.";
-            } else {
-                qDebug() << "Failed to start background music:" << backgroundMusicProcess->errorString();
-                delete backgroundMusicProcess;
-                backgroundMusicProcess = nullptr;
-            }
-        }
+        // IMA ADPCM 버전이 있으면 우선 사용 (NFS 전송량 약 1/4)
+        // 생성: ffmpeg -i background.wav -acodec adpcm_ima_wav background_adpcm.wav
+        const QString compressed = "/mnt/nfs/wav/background_adpcm.wav";
+        AudioEngine::instance()->playMusic(QFile::exists(compressed) ? compressed : "/mnt/nfs/wav/background.wav");
     } else {
+        AudioEngine::instance()->stopMusic();
         qDebug() << "Background music disabled.";
     }
 }
@@ -48,7 +48,6 @@ private:
     
     // 배경 음악 관련
     bool backgroundMusicEnabled;
-    QProcess *backgroundMusicProcess;
     int volumeLevel;
     
     // 게임 윈도우 생성 상태 관리
@@ -61,7 +60,7 @@ private:
     void createNewGameWindow();  // 새 함수 추가
     void cleanupGameWindow();    // 게임 윈도우 정리 함수
     void initAudio();            // 오디오 초기화
-    void controlBackgroundMusicProcess(bool start);  // 배경 음악 제어
+    void controlBackgroundMusic(bool start);  // 배경 음악 제어
 };
 
 #endif // MAINWINDOW_H
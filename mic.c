@@ -4,6 +4,14 @@
 #include <stdint.h>
 #include <math.h>
 #include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include "echoref.h"
+
+// 빌드: gcc -O2 mic.c -o mic -lasound -lm -lrt
+// 실행: ./mic [-d]   (-d: 듀플렉스 모드, 게임 오디오 엔진의 출력 신호로 에코 제거)
 
 #define SAMPLE_RATE 16000
 #define FRAME_SIZE 1024
@@ -14,6 +22,14 @@
 #define MIN_VOLUME 300
 #define DELAY 50000
 
+// 에코 제거(NLMS) 파라미터
+#define ECHO_TAPS 512                 // 필터 길이 (32ms @16kHz, 스피커→마이크 경로 + 타임스탬프 오차)
+#define ECHO_LEAD 64                  // 타임스탬프 오차 보정용 선행 탭 (4ms)
+#define ECHO_MU 0.3f                  // 적응 스텝
+#define ECHO_EPS 1.0e5f               // 무음 구간 발산 방지
+#define ECHO_DOUBLE_TALK 0.6f         // Geigel 더블토크 판정 비율 (사용자가 노래하면 적응 중지)
+#define ECHO_STALE_NS 500000000LL     // 참조 신호가 이보다 오래되면 사용 안 함
+
 // 볼륨(RMS) 계산 함수
 static double calculate_rms(short *buffer, int size) {
     double sum = 0.0;
@@ -62,6 +78,90 @@ double detect_pitch_int(short *buffer, int size, int sample_rate) {
     }
 }
 
+static int64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// 게임 오디오 엔진이 공유하는 참조 신호 매핑 (엔진이 아직 없으면 NULL)
+static const echoref_t *open_echo_reference(void) {
+    int fd = shm_open(ECHOREF_SHM_NAME, O_RDONLY, 0);
+    if (fd < 0) return NULL;
+    void *mem = mmap(NULL, sizeof(echoref_t), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) return NULL;
+    const echoref_t *ref = (const echoref_t *)mem;
+    if (ref->magic != ECHOREF_MAGIC || ref->rate != SAMPLE_RATE) {
+        munmap(mem, sizeof(echoref_t));
+        return NULL;
+    }
+    return ref;
+}
+
+// 캡처 블록 첫 샘플 시각(first_ns)에 대응하는 참조 구간을 dst에 복사 (count = 블록 + 탭 - 1)
+static int fetch_echo_reference(const echoref_t *ref, int64_t first_ns, short *dst, int count) {
+    uint64_t write_pos, anchor_pos;
+    int64_t anchor_ns;
+    if (!echoref_snapshot(ref, &write_pos, &anchor_pos, &anchor_ns)) return 0;
+    if (ref->magic != ECHOREF_MAGIC) return 0;
+    if (monotonic_ns() - anchor_ns > ECHO_STALE_NS) return 0;
+
+    int64_t offset = (first_ns - anchor_ns) * SAMPLE_RATE / 1000000000LL;
+    int64_t start = (int64_t)anchor_pos + offset + ECHO_LEAD - (ECHO_TAPS - 1);
+    if (start < 0 || start + count > (int64_t)write_pos) return 0;
+    if ((int64_t)write_pos - start > ECHOREF_FRAMES) return 0;
+
+    for (int i = 0; i < count; ++i)
+        dst[i] = ref->samples[(start + i) & (ECHOREF_FRAMES - 1)];
+
+    // 복사하는 동안 덮어써졌는지 확인
+    uint64_t after_pos, after_anchor;
+    int64_t after_ns;
+    if (!echoref_snapshot(ref, &after_pos, &after_anchor, &after_ns)) return 0;
+    return (int64_t)after_pos - start <= ECHOREF_FRAMES;
+}
+
+// NLMS 적응 필터로 참조 신호의 에코를 마이크 신호에서 제거 (결과는 mic에 덮어씀)
+static float echo_weights[ECHO_TAPS];
+static void cancel_echo(short *mic, const short *ref, int size) {
+    // Geigel 더블토크 판정용 참조 최대값
+    int ref_max = 0;
+    for (int i = 0; i < size + ECHO_TAPS - 1; ++i) {
+        int a = abs(ref[i]);
+        if (a > ref_max) ref_max = a;
+    }
+    if (ref_max == 0) return; // 게임 소리가 없으면 그대로 사용
+
+    float energy = 0.0f;
+    for (int k = 0; k < ECHO_TAPS; ++k)
+        energy += (float)ref[k] * ref[k];
+
+    for (int i = 0; i < size; ++i) {
+        const short *x = ref + i + ECHO_TAPS - 1; // x[0]이 최신 샘플
+        if (i > 0) {
+            energy += (float)x[0] * x[0];
+            energy -= (float)ref[i - 1] * ref[i - 1];
+            if (energy < 0.0f) energy = 0.0f;
+        }
+
+        float estimate = 0.0f;
+        for (int k = 0; k < ECHO_TAPS; ++k)
+            estimate += echo_weights[k] * x[-k];
+
+        float error = (float)mic[i] - estimate;
+        if (abs(mic[i]) < ECHO_DOUBLE_TALK * ref_max) {
+            float step = ECHO_MU * error / (energy + ECHO_EPS);
+            for (int k = 0; k < ECHO_TAPS; ++k)
+                echo_weights[k] += step * x[-k];
+        }
+
+        if (error > 32767.0f) error = 32767.0f;
+        if (error < -32768.0f) error = -32768.0f;
+        mic[i] = (short)error;
+    }
+}
+
 // 점수 계산 함수 (A2~A5, # 포함, 플랫 제외)
 static int get_pitch_score(const char *note, int octave) {
     // 점수는 A2(1) ~ A5(37)
@@ -86,7 +186,7 @@ static int get_pitch_score(const char *note, int octave) {
     return 0; // 범위 밖
 }
 
-int main() {
+int main(int argc, char **argv) {
     const char *device = "plughw:2,0"; // 마이크 장치
     snd_pcm_t *pcm_handle;
     snd_pcm_hw_params_t *params;
@@ -94,6 +194,14 @@ int main() {
 
     short buffer[FRAME_SIZE];
 
+    // 듀플렉스 모드 (게임이 재생 중인 소리를 빼고 분석)
+    int duplex = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-d") == 0 || strcmp(argv[i], "--duplex") == 0) duplex = 1;
+    }
+    const echoref_t *echo_ref = NULL;
+    static short ref_block[FRAME_SIZE + ECHO_TAPS - 1];
+
     // ALSA PCM 캡처 장치 열기
     if ((pcm = snd_pcm_open(&pcm_handle, device, SND_PCM_STREAM_CAPTURE, 0)) < 0) {
         fprintf(stderr, "ERROR: Cannot open PCM device %s: %s\n", device, snd_strerror(pcm));
@@ -132,8 +240,29 @@ int main() {
             continue;
         }
 
-        // 볼륨(RMS) 계산
+        // 듀플렉스 모드: 캡처 시각에 맞는 참조 신호로 에코 제거
+        if (duplex) {
+            if (!echo_ref) echo_ref = open_echo_reference();
+            if (echo_ref) {
+                snd_pcm_sframes_t pending = 0;
+                if (snd_pcm_delay(pcm_handle, &pending) < 0) pending = 0;
+                int64_t first_ns = monotonic_ns() - (int64_t)(pending + FRAME_SIZE) * 1000000000LL / SAMPLE_RATE;
+                if (fetch_echo_reference(echo_ref, first_ns, ref_block, FRAME_SIZE + ECHO_TAPS - 1)) {
+                    cancel_echo(buffer, ref_block, FRAME_SIZE);
+                } else if (echo_ref->magic != ECHOREF_MAGIC) {
+                    // 게임이 재시작되어 공유 메모리가 바뀜 - 다시 매핑
+                    munmap((void *)echo_ref, sizeof(echoref_t));
+                    echo_ref = NULL;
+                }
+            }
+        }
+
+        // 볼륨(RMS) 계산 - 에코 제거 후 조용하면 피치 분석 생략
         double rms = calculate_rms(buffer, FRAME_SIZE);
+        if (rms < MIN_VOLUME) {
+            usleep(DELAY);
+            continue;
+        }
         // 피치 계산
         double pitch = detect_pitch_int(buffer, FRAME_SIZE, SAMPLE_RATE);
         const char *note;
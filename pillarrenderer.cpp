@@ -0,0 +1,94 @@
+#include "pillarrenderer.h"
+#include <QDebug>
+
+// 원본 이미지(1024x768) 기준 좌표
+// brick_pillar_bottom.png: 캡 y 217~323, 그 아래 몸통은 벽돌 두 줄(192px)마다 반복
+// brick_pillar_top.png: 캡 y 242~346 (몸통은 위쪽)
+static const QRect BODY_SOURCE(288, 323, 450, 192);
+static const QRect BOTTOM_CAP_SOURCE(265, 217, 497, 106);
+static const QRect TOP_CAP_SOURCE(265, 242, 497, 105);
+
+PillarRenderer::PillarRenderer()
+    : loadAttempted(false)
+{
+}
+
+// 원본 몸통 너비를 PILLAR_WIDTH에 맞추는 비율로 모든 타일을 한 번만 스케일
+static QPixmap scaledTile(const QPixmap &source, const QRect &rect)
+{
+    const qreal scale = qreal(PillarRenderer::PILLAR_WIDTH) / BODY_SOURCE.width();
+    const int w = qMax(1, qRound(rect.width() * scale));
+    const int h = qMax(1, qRound(rect.height() * scale));
+    return source.copy(rect).scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+}
+
+void PillarRenderer::load()
+{
+    loadAttempted = true;
+
+    QPixmap top;
+    QPixmap bottom;
+    if (bottom.load("/mnt/nfs/brick_pillar_bottom.png")) {
+        bodyTile = scaledTile(bottom, BODY_SOURCE);
+        bottomCap = scaledTile(bottom, BOTTOM_CAP_SOURCE);
+    }
+    if (top.load("/mnt/nfs/brick_pillar_top.png"))
+        topCap = scaledTile(top, TOP_CAP_SOURCE);
+
+    // 캡 이미지가 없으면 기존 brick_pillar.png 중앙 부분을 몸통 타일로 사용
+    if (bodyTile.isNull()) {
+        QPixmap pillar;
+        if (pillar.load("/mnt/nfs/brick_pillar.png"))
+            bodyTile = pillar.copy((pillar.width() - PILLAR_WIDTH) / 2, 0, PILLAR_WIDTH, pillar.height());
+    }
+    if (bodyTile.isNull()) {
+        bodyTile = QPixmap(PILLAR_WIDTH, 32);
+        bodyTile.fill(Qt::red);
+    }
+
+    bodyMask = CollisionMask::fromPixmap(bodyTile);
+    topCapMask = CollisionMask::fromPixmap(topCap);
+    bottomCapMask = CollisionMask::fromPixmap(bottomCap);
+
+    qDebug() << "PillarRenderer: body" << bodyTile.size() << "caps" << topCap.size() << bottomCap.size()
+             << memoryBytes() << "bytes";
+}
+
+int PillarRenderer::memoryBytes() const
+{
+    int bytes = 0;
+    for (const QPixmap *p : { &bodyTile, &topCap, &bottomCap })
+        bytes += p->width() * p->height() * p->depth() / 8;
+    return bytes;
+}
+
+int PillarRenderer::drawnWidth() const
+{
+    return qMax(bodyTile.width(), qMax(topCap.width(), bottomCap.width()));
+}
+
+// 배치는 GameScene::addPillar 참고: 몸통은 장애물 가운데, 캡은 몸통 가운데에 맞추고
+// 위쪽 장애물은 몸통 타일의 끝이 캡에 맞닿도록 위상을 맞춤
+bool PillarRenderer::collides(const QRect &obstacle, bool capAtBottom, const CollisionMask &mask, const QPoint &maskAt) const
+{
+    const int h = obstacle.height();
+    if (h <= 0 || bodyMask.isNull()) return false;
+
+    const CollisionMask &capMask = capAtBottom ? topCapMask : bottomCapMask;
+    const int capH = capMask.isNull() ? 0 : qMin(capMask.height(), h);
+    const int bodyH = h - capH;
+    const int x = obstacle.x() + (obstacle.width() - bodyMask.width()) / 2;
+    const int capX = x - (capMask.width() - bodyMask.width()) / 2;
+
+    if (capAtBottom) {
+        const int tileH = bodyMask.height();
+        const int phase = (tileH - bodyH % tileH) % tileH;
+        if (mask.overlaps(maskAt, bodyMask, QPoint(x, obstacle.y() - phase), QRect(x, obstacle.y(), bodyMask.width(), bodyH), true))
+            return true;
+        return capH > 0 && mask.overlaps(maskAt, capMask, QPoint(capX, obstacle.y() + bodyH - (capMask.height() - capH)),
+                                         QRect(capX, obstacle.y() + bodyH, capMask.width(), capH));
+    }
+    if (capH > 0 && mask.overlaps(maskAt, capMask, QPoint(capX, obstacle.y()), QRect(capX, obstacle.y(), capMask.width(), capH)))
+        return true;
+    return mask.overlaps(maskAt, bodyMask, QPoint(x, obstacle.y() + capH), QRect(x, obstacle.y() + capH, bodyMask.width(), bodyH), true);
+}
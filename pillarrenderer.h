@@ -0,0 +1,43 @@
+#ifndef PILLARRENDERER_H
+#define PILLARRENDERER_H
+
+#include <QPixmap>
+#include <QRect>
+#include "collisionmask.h"
+
+// 기둥 타일
+// 높이마다 스케일한 픽스맵을 캐싱하는 대신, 로드 시 한 번만 만든 고정 크기 타일
+// (반복되는 몸통 조각 + 위/아래 캡)으로 기둥을 그림 → 메모리 일정, 실행 중 스케일 없음
+// 타일 배치는 GameScene::addPillar가 담당
+class PillarRenderer
+{
+public:
+    static const int PILLAR_WIDTH = 60;  // 화면에 그려지는 기둥 몸통 너비
+
+    PillarRenderer();
+
+    // NFS 이미지에서 타일 생성 (실패 시 빨간 단색 타일로 대체)
+    void load();
+    bool isLoaded() const { return loadAttempted; }
+
+    const QPixmap &body() const { return bodyTile; }
+    const QPixmap &cap(bool capAtBottom) const { return capAtBottom ? topCap : bottomCap; }
+
+    int memoryBytes() const;
+
+    // 캡까지 포함해 그려지는 가장 넓은 너비 (광역 단계에서 장애물 사각형을 넓히는 데 사용)
+    int drawnWidth() const;
+    // GameScene::addPillar와 같은 배치로 그려진 기둥이 mask(maskAt 위치)와 불투명 픽셀 단위로 겹치는지
+    bool collides(const QRect &obstacle, bool capAtBottom, const CollisionMask &mask, const QPoint &maskAt) const;
+
+private:
+    QPixmap bodyTile;   // 세로로 반복 가능한 몸통 한 주기
+    QPixmap topCap;     // 위쪽 장애물 끝 (brick_pillar_top.png)
+    QPixmap bottomCap;  // 아래쪽 장애물 끝 (brick_pillar_bottom.png)
+    CollisionMask bodyMask;     // 타일과 같은 크기의 충돌 마스크
+    CollisionMask topCapMask;
+    CollisionMask bottomCapMask;
+    bool loadAttempted;
+};
+
+#endif // PILLARRENDERER_H
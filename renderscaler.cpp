@@ -0,0 +1,90 @@
+#include "renderscaler.h"
+#include <QDebug>
+
+RenderScaler::RenderScaler()
+    : currentScale(1.0)
+    , maxScale(1.0)
+    , dynamic(false)
+    , backgroundKey(0)
+    , backgroundScale(0.0)
+    , paintSumMs(0.0)
+    , sampleCount(0)
+{
+}
+
+void RenderScaler::configure(qreal scale, bool autoScale)
+{
+    maxScale = qBound(qreal(MIN_SCALE), scale, qreal(1.0));
+    dynamic = autoScale;
+    setScale(maxScale);
+}
+
+void RenderScaler::setScale(qreal scale)
+{
+    currentScale = scale;
+    paintSumMs = 0.0;
+    sampleCount = 0;
+}
+
+QImage &RenderScaler::frame(const QSize &viewSize)
+{
+    const QSize pixels(qMax(1, qRound(viewSize.width() * currentScale)), qMax(1, qRound(viewSize.height() * currentScale)));
+    if (frameImage.size() != pixels) {
+        // 불투명 포맷 (화면 복사 시 알파 합성 없음)
+        frameImage = QImage(pixels, QImage::Format_RGB32);
+        frameImage.fill(Qt::black);
+    }
+    return frameImage;
+}
+
+const QPixmap &RenderScaler::background(const QPixmap &full)
+{
+    if (full.isNull()) {
+        scaledBackground = QPixmap();
+        backgroundKey = 0;
+    } else if (full.cacheKey() != backgroundKey || backgroundScale != currentScale) {
+        const QSize size(qMax(1, qRound(full.width() * currentScale)), qMax(1, qRound(full.height() * currentScale)));
+        scaledBackground = full.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        backgroundKey = full.cacheKey();
+        backgroundScale = currentScale;
+    }
+    return scaledBackground;
+}
+
+QRegion RenderScaler::mapToFrame(const QRegion &region) const
+{
+    QRegion mapped;
+    for (const QRect &r : region) {
+        mapped += QRectF(r.x() * currentScale, r.y() * currentScale,
+                         r.width() * currentScale, r.height() * currentScale).toAlignedRect();
+    }
+    return mapped;
+}
+
+bool RenderScaler::reportFrame(double paintMs, double budgetMs)
+{
+    if (!dynamic || budgetMs <= 0.0) return false;
+    paintSumMs += paintMs;
+    if (++sampleCount < SAMPLE_FRAMES) return false;
+
+    const double load = paintSumMs / sampleCount / budgetMs;
+    qreal next = currentScale;
+    if (load > HIGH_LOAD && currentScale > MIN_SCALE)
+        next = qMax(qreal(MIN_SCALE), currentScale - SCALE_STEP);
+    else if (load < LOW_LOAD && currentScale < maxScale)
+        next = qMin(maxScale, currentScale + SCALE_STEP);
+
+    if (next == currentScale) {
+        paintSumMs = 0.0;
+        sampleCount = 0;
+        return false;
+    }
+    qDebug() << "RenderScaler: paint load" << load << "scale" << currentScale << "->" << next;
+    setScale(next);
+    return true;
+}
+
+QString RenderScaler::statusText() const
+{
+    return QString("Render scale: %1%2").arg(currentScale, 0, 'f', 3).arg(dynamic ? " (auto)" : "");
+}
@@ -0,0 +1,58 @@
+#ifndef RENDERSCALER_H
+#define RENDERSCALER_H
+
+#include <QImage>
+#include <QPixmap>
+#include <QRegion>
+#include <QSize>
+#include <QString>
+
+// 내부 렌더 해상도 (래스터 백엔드)
+// 장면을 화면보다 작은 오프스크린 이미지에 그린 뒤 화면에는 한 번만 확대 복사
+// 게임 좌표(위젯 논리 좌표)는 그대로 두고 QPainter 배율로만 채우는 픽셀 수를 줄임
+// 자동 모드에서는 그리기 시간이 프레임 예산을 계속 넘으면 배율을 낮추고, 여유가 이어지면 다시 올림
+class RenderScaler
+{
+public:
+    RenderScaler();
+
+    // maxScale: 상한(1.0이면 원래 해상도), dynamic: 자동 조절 여부
+    void configure(qreal maxScale, bool dynamic);
+
+    qreal scale() const { return currentScale; }
+    bool isScaled() const { return currentScale < 1.0; }
+    bool isDynamic() const { return dynamic; }
+
+    // 현재 배율의 오프스크린 이미지 (창 크기/배율이 바뀌면 다시 할당)
+    QImage &frame(const QSize &viewSize);
+    // 출력 해상도로 미리 줄인 배경 (원본이 바뀐 경우에만 다시 스케일)
+    const QPixmap &background(const QPixmap &full);
+    // 위젯 좌표 영역 → 오프스크린 이미지 좌표 (바깥쪽으로 맞춤)
+    QRegion mapToFrame(const QRegion &region) const;
+
+    // 프레임 그리기 시간 보고 (배율이 바뀌면 true - 호출자가 전체 다시 그리기 요청)
+    bool reportFrame(double paintMs, double budgetMs);
+
+    QString statusText() const;
+
+private:
+    static constexpr qreal MIN_SCALE = 0.5;
+    static constexpr qreal SCALE_STEP = 0.125;
+    static const int SAMPLE_FRAMES = 30;      // 판단 전에 모으는 프레임 수
+    static constexpr double HIGH_LOAD = 0.5;  // 예산 대비 이 비율을 넘으면 낮춤 (시뮬레이션/합성 몫 남김)
+    static constexpr double LOW_LOAD = 0.2;   // 이 비율 아래면 올림
+
+    void setScale(qreal scale);
+
+    qreal currentScale;
+    qreal maxScale;
+    bool dynamic;
+    QImage frameImage;
+    QPixmap scaledBackground;
+    qint64 backgroundKey;
+    qreal backgroundScale;
+    double paintSumMs;
+    int sampleCount;
+};
+
+#endif // RENDERSCALER_H
@@ -0,0 +1,82 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <QtGlobal>
+
+// 고정 용량 FIFO 링 버퍼 (게임 엔티티용)
+// 엔티티는 항상 오른쪽에서 생성되어 왼쪽으로 사라지므로 앞에서 꺼내는 것만으로 만료 처리가 됨
+// 저장 공간은 객체 안에 고정 배열로 잡혀 있어 플레이 중 할당/재배치가 없음
+// Capacity는 2의 거듭제곱 (인덱스 계산을 마스크로 처리)
+template <typename T, int Capacity>
+class RingBuffer
+{
+    Q_STATIC_ASSERT_X(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    template <typename Ring, typename Value>
+    class Iterator
+    {
+    public:
+        Iterator(Ring *ring, int index) : ring(ring), index(index) {}
+        Value &operator*() const { return (*ring)[index]; }
+        Value *operator->() const { return &(*ring)[index]; }
+        Iterator &operator++() { ++index; return *this; }
+        bool operator==(const Iterator &other) const { return index == other.index; }
+        bool operator!=(const Iterator &other) const { return index != other.index; }
+
+    private:
+        Ring *ring;
+        int index;
+    };
+    typedef Iterator<RingBuffer, T> iterator;
+    typedef Iterator<const RingBuffer, const T> const_iterator;
+
+    RingBuffer() : head(0), count(0) {}
+
+    static int capacity() { return Capacity; }
+    int size() const { return count; }
+    bool isEmpty() const { return count == 0; }
+    bool isFull() const { return count == Capacity; }
+
+    // 가득 차 있으면 추가하지 않고 false
+    bool append(const T &value)
+    {
+        if (count == Capacity) return false;
+        items[(head + count) & (Capacity - 1)] = value;
+        ++count;
+        return true;
+    }
+
+    T &first() { Q_ASSERT(count > 0); return items[head]; }
+    const T &first() const { Q_ASSERT(count > 0); return items[head]; }
+
+    // 가장 오래된 항목 제거 (O(1))
+    void removeFirst()
+    {
+        Q_ASSERT(count > 0);
+        head = (head + 1) & (Capacity - 1);
+        --count;
+    }
+
+    void clear()
+    {
+        head = 0;
+        count = 0;
+    }
+
+    // 0이 가장 오래된 항목
+    T &operator[](int i) { Q_ASSERT(i >= 0 && i < count); return items[(head + i) & (Capacity - 1)]; }
+    const T &operator[](int i) const { Q_ASSERT(i >= 0 && i < count); return items[(head + i) & (Capacity - 1)]; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, count); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count); }
+
+private:
+    T items[Capacity];
+    int head;
+    int count;
+};
+
+#endif // RINGBUFFER_H
@@ -0,0 +1,514 @@
+// 헤드리스 시뮬레이션 실행기 (창/마이크 없이 GameSimulation만 구동)
+// 빌드: qmake simrunner.pro && make
+//   (또는 g++ -O2 -std=c++11 -fPIC -DALLOCATION_COUNTER simrunner.cpp allocationcounter.cpp gamesimulation.cpp levelgenerator.cpp difficultyengine.cpp entitystore.cpp -o simrunner $(pkg-config --cflags --libs Qt5Core))
+// 사용법: ./simrunner [옵션]
+//   --ticks N        전체 스텝 수 (기본 1000000, 게임이 끝나면 같은 설정으로 다시 시작)
+//   --seed S         난수 시드 (입력 생성과 GameSimulation 시드)
+//   --input MODE     random(기본) | sine | chase(다음 틈을 따라감) | idle | script:파일
+//                    스크립트 한 줄: <스텝 수> <피치 점수> [up] [down] (피치 0이면 무성)
+//   --size WxH       월드 크기 (기본 1920x1080)
+//   --level MODE     random(기본) | scale[:major|minor|pentatonic|chromatic] | melody[:번호]
+//   --interval N     scale 모드의 이웃한 틈 사이 최대 음계 간격 (기본 2도)
+//   --difficulty P   난이도 프로파일 (normal(기본) | classic | practice | hard)
+//   --song N         레벨의 처음 N쌍 피치 트랙(도착 스텝, 음)만 출력하고 종료
+//   --max-steps N    게임 하나의 최대 스텝 수 (기본 10분, 끝나지 않는 입력/보드 조합 방지)
+//   --fuzz           게임마다 월드 크기/입력 방식/레벨 모드/난이도를 무작위로 바꾸며 불변 조건 검사
+//                    (스윕 충돌 검증용으로 장애물+플레이어 너비보다 빠른 프로파일도 섞음)
+//   --verify         게임마다 같은 입력으로 한 번 더 실행해 stateHash가 같은지 확인 (결정성)
+//                    같은 프로세스 안의 재실행이므로 프로세스/보드 사이 차이(컴파일러, 월드 크기 등)는 잡지 못함
+//                    → 보드마다 같은 옵션으로 실행해 마지막 줄의 Run hash를 비교하거나 --expect-hash로 기준값과 비교
+//   --expect-hash H  전체 게임의 stateHash를 합친 Run hash가 H(16진수)와 다르면 종료 코드 1
+// 출력: 초당 스텝 수, 스텝 중 할당 횟수, 점수 분포, 음 정확도, 불변 조건 위반 (위반이 있으면 종료 코드 1), Run hash
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QStringList>
+#include <QTextStream>
+#include <QVector>
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "allocationcounter.h"
+#include "gamesimulation.h"
+
+enum InputMode { InputRandom, InputSine, InputChase, InputIdle, InputScript };
+
+struct ScriptStep {
+    int steps;
+    SimInput input;
+};
+
+// 실행기 자체 난수 (입력 생성용, GameSimulation과 독립)
+static quint32 lcgState = 1;
+static int nextRandom(int bound)
+{
+    lcgState = lcgState * 1103515245u + 12345u;
+    return int((lcgState >> 16) % quint32(bound));
+}
+
+// 피치 리더(20Hz)처럼 3스텝마다만 값이 바뀌는 입력 생성기
+class InputSource
+{
+public:
+    InputSource(InputMode mode, const QVector<ScriptStep> &script)
+        : mode(mode), script(script), pitch(19), scriptIndex(0), scriptLeft(0), tick(0) {}
+
+    void restart()
+    {
+        pitch = 19;
+        scriptIndex = 0;
+        scriptLeft = script.isEmpty() ? 0 : script[0].steps;
+        tick = 0;
+        current = SimInput();
+    }
+
+    SimInput next(const GameSimulation &sim)
+    {
+        const bool sample = tick++ % 3 == 0;
+        switch (mode) {
+        case InputRandom:
+            if (sample) {
+                pitch = qBound(1, pitch + nextRandom(9) - 4, 37);
+                current.voiced = nextRandom(10) != 0;
+                current.pitchScore = current.voiced ? pitch : 0;
+                current.up = nextRandom(50) == 0;
+                current.down = nextRandom(50) == 0;
+            }
+            break;
+        case InputSine:
+            if (sample) {
+                // 약 8초 주기로 전 음역을 오르내림 (정수 삼각파)
+                const int phase = (tick / 3) % 160;
+                current.pitchScore = 1 + (phase < 80 ? phase : 160 - phase) * 36 / 80;
+                current.voiced = true;
+            }
+            break;
+        case InputChase: {
+            const int gapPitch = sim.upcomingGapPitch();
+            if (sample) {
+                current.voiced = gapPitch > 0;
+                current.pitchScore = gapPitch;
+            }
+            break;
+        }
+        case InputIdle:
+            current = SimInput();
+            break;
+        case InputScript:
+            while (scriptIndex < script.size() && scriptLeft <= 0) {
+                if (++scriptIndex < script.size())
+                    scriptLeft = script[scriptIndex].steps;
+            }
+            if (scriptIndex >= script.size()) {
+                // 스크립트가 끝나면 처음부터 반복
+                scriptIndex = 0;
+                scriptLeft = script.isEmpty() ? 0 : script[0].steps;
+            }
+            if (!script.isEmpty()) {
+                current = script[scriptIndex].input;
+                --scriptLeft;
+            }
+            break;
+        }
+        return current;
+    }
+
+private:
+    InputMode mode;
+    const QVector<ScriptStep> &script;
+    int pitch;
+    int scriptIndex;
+    int scriptLeft;
+    int tick;
+    SimInput current;
+};
+
+static bool loadScript(const QString &fileName, QVector<ScriptStep> &script)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) return false;
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        const QStringList parts = in.readLine().simplified().split(' ', Qt::SkipEmptyParts);
+        if (parts.size() < 2 || parts[0].startsWith('#')) continue;
+        ScriptStep step;
+        step.steps = qMax(1, parts[0].toInt());
+        step.input.pitchScore = qBound(0, parts[1].toInt(), 37);
+        step.input.voiced = step.input.pitchScore > 0;
+        step.input.up = parts.contains("up");
+        step.input.down = parts.contains("down");
+        script.append(step);
+    }
+    return !script.isEmpty();
+}
+
+// 불변 조건 위반 기록 (처음 몇 개만 출력, 종류별 개수는 끝에 요약)
+struct Violations {
+    static const int MAX_KINDS = 8;
+    int count;
+    int kinds;
+    const char *kindName[MAX_KINDS];
+    int kindCount[MAX_KINDS];
+    Violations() : count(0), kinds(0) {}
+
+    void report(int game, quint64 step, const GameSimulation &sim, const char *what)
+    {
+        int kind = 0;
+        while (kind < kinds && strcmp(kindName[kind], what) != 0) ++kind;
+        if (kind == kinds && kinds < MAX_KINDS) {
+            kindName[kinds] = what;
+            kindCount[kinds++] = 0;
+        }
+        if (kind < kinds) ++kindCount[kind];
+        if (++count <= 20) {
+            printf("VIOLATION game %d step %llu (%dx%d seed %u): %s [player y %d, score %d, hash %08x]\n",
+                   game, (unsigned long long)step, sim.config().width, sim.config().height, sim.config().seed,
+                   what, sim.player().y(), sim.score(), sim.stateHash());
+        }
+    }
+};
+
+// 방금 생성된 장애물 쌍(맨 뒤 두 항목) 검사: 틈이 화면 안에 있고 플레이어가 들어가며,
+// 직전 틈을 빠져나온 뒤 다음 틈에 들어가기 전까지 움직일 수 있는 거리 안에 있는지
+static void checkSpawn(const GameSimulation &sim, int &previousCenter, int &previousSize, int game, Violations &violations)
+{
+    const GameSimulation::ObstacleStore &obstacles = sim.obstacles();
+    if (obstacles.size() < 2) return;
+    const QRect top = obstacles.rect(obstacles.size() - 2);
+    const QRect bottom = obstacles.rect(obstacles.size() - 1);
+    const int gapTop = top.y() + top.height();
+    const int gapBottom = bottom.y();
+    const int height = sim.config().height;
+    if (!obstacles.hasFlag(obstacles.size() - 2, GameSimulation::ObstacleStore::TopObstacle))
+        violations.report(game, sim.stepCount(), sim, "spawned pair is not top/bottom ordered");
+    if (gapTop < 0 || gapBottom > height || top.height() <= 0 || bottom.height() <= 0)
+        violations.report(game, sim.stepCount(), sim, "gap outside the world");
+    if (gapBottom - gapTop < GameSimulation::PLAYER_SIZE)
+        violations.report(game, sim.stepCount(), sim, "gap narrower than the player");
+
+    // 직전 쌍과의 실제 간격에서 빈 구간을 지금 속도로 지나는 스텝 수 × 스텝당 이동 + 두 틈 안에서의 여유
+    // (직전 쌍이 이미 화면을 벗어났으면 충분히 멀리 있으므로 검사하지 않음)
+    const int gapCenter = (gapTop + gapBottom) / 2;
+    const int gapSize = gapBottom - gapTop;
+    if (previousCenter >= 0 && obstacles.size() >= 4) {
+        const int spacing = top.x() - obstacles.rect(obstacles.size() - 4).x()
+                          - GameSimulation::OBSTACLE_WIDTH - GameSimulation::PLAYER_SIZE;
+        const int reach = qMax(0, spacing) * DifficultyEngine::SPEED_ONE / sim.difficulty().speed() * GameSimulation::PLAYER_SPEED
+                        + (previousSize - GameSimulation::PLAYER_SIZE) / 2 + (gapSize - GameSimulation::PLAYER_SIZE) / 2;
+        if (qAbs(gapCenter - previousCenter) > reach + 1)
+            violations.report(game, sim.stepCount(), sim, "gap unreachable from the previous gap");
+    }
+    previousCenter = gapCenter;
+    previousSize = gapSize;
+}
+
+// 충돌 없이 지나간 스텝에서 이동 경로를 1픽셀 간격으로 따라가며 장애물과 겹친 적이 없는지 (스윕 판정 검증)
+static void checkTunnelling(const GameSimulation &sim, int previousY, int game, Violations &violations)
+{
+    const QRect &player = sim.player();
+    const int scroll = sim.lastScroll();
+    const int dy = previousY - player.y();
+    const int samples = qMax(qAbs(scroll), qAbs(dy));
+    const GameSimulation::ObstacleStore &obstacles = sim.obstacles();
+    for (int i = 0; i < obstacles.size(); ++i) {
+        const QRect obstacle = obstacles.rect(i);
+        if (obstacle.left() > player.right() + scroll || obstacle.right() < player.left()) continue;
+        for (int k = 0; k < samples; ++k) {
+            if (player.translated(scroll * k / samples, dy * k / samples).intersects(obstacle)) {
+                violations.report(game, sim.stepCount(), sim, "tunnelled through an obstacle");
+                return;
+            }
+        }
+    }
+}
+
+static void checkStep(const GameSimulation &sim, int previousScore, int game, Violations &violations)
+{
+    const QRect &player = sim.player();
+    if (player.y() < 0 || player.y() > sim.config().height - GameSimulation::PLAYER_SIZE)
+        violations.report(game, sim.stepCount(), sim, "player out of bounds");
+    if (sim.score() < previousScore)
+        violations.report(game, sim.stepCount(), sim, "score decreased");
+    const GameSimulation::ObstacleStore &obstacles = sim.obstacles();
+    for (int i = 1; i < obstacles.size(); ++i) {
+        if (obstacles.rect(i).x() < obstacles.rect(i - 1).x()) {
+            violations.report(game, sim.stepCount(), sim, "obstacles not ordered by x");
+            break;
+        }
+    }
+}
+
+static const char *modeName(InputMode mode)
+{
+    static const char *names[] = { "random", "sine", "chase", "idle", "script" };
+    return names[mode];
+}
+
+int main(int argc, char **argv)
+{
+    quint64 ticks = 1000000;
+    quint64 maxSteps = quint64(GameSimulation::STEP_HZ) * 600;
+    quint32 seed = GameSimulation::DEFAULT_SEED;
+    InputMode mode = InputRandom;
+    QVector<ScriptStep> script;
+    int width = 1920;
+    int height = 1080;
+    bool fuzz = false;
+    bool verify = false;
+    bool expectHash = false;
+    quint32 expectedRunHash = 0;
+    int songLength = 0;
+    GameSimulation::Config level;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : "";
+        if (strcmp(arg, "--ticks") == 0) {
+            ticks = strtoull(value, nullptr, 10);
+            ++i;
+        } else if (strcmp(arg, "--seed") == 0) {
+            seed = quint32(strtoul(value, nullptr, 0));
+            ++i;
+        } else if (strcmp(arg, "--input") == 0) {
+            const QString m = QString::fromLocal8Bit(value);
+            if (m == "random") mode = InputRandom;
+            else if (m == "sine") mode = InputSine;
+            else if (m == "chase") mode = InputChase;
+            else if (m == "idle") mode = InputIdle;
+            else if (m.startsWith("script:") && loadScript(m.mid(7), script)) mode = InputScript;
+            else {
+                fprintf(stderr, "Unknown or empty input: %s\n", value);
+                return 1;
+            }
+            ++i;
+        } else if (strcmp(arg, "--size") == 0) {
+            if (sscanf(value, "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0) {
+                fprintf(stderr, "Invalid size: %s\n", value);
+                return 1;
+            }
+            ++i;
+        } else if (strcmp(arg, "--level") == 0) {
+            const QString m = QString::fromLocal8Bit(value);
+            const QString option = m.mid(m.indexOf(':') + 1);
+            if (m == "random") {
+                level.levelMode = LevelGenerator::RandomGaps;
+            } else if (m.startsWith("scale")) {
+                level.levelMode = LevelGenerator::ScaleWalk;
+                if (option == "minor") level.scale = LevelGenerator::Minor;
+                else if (option == "pentatonic") level.scale = LevelGenerator::Pentatonic;
+                else if (option == "chromatic") level.scale = LevelGenerator::Chromatic;
+            } else if (m.startsWith("melody")) {
+                level.levelMode = LevelGenerator::Melody;
+                level.melody = m.contains(':') ? option.toInt() : 0;
+            } else {
+                fprintf(stderr, "Unknown level mode: %s\n", value);
+                return 1;
+            }
+            ++i;
+        } else if (strcmp(arg, "--difficulty") == 0) {
+            level.difficulty = &DifficultyEngine::profile(QString::fromLocal8Bit(value));
+            if (QString::fromLocal8Bit(value) != level.difficulty->name) {
+                fprintf(stderr, "Unknown difficulty profile: %s\n", value);
+                return 1;
+            }
+            ++i;
+        } else if (strcmp(arg, "--interval") == 0) {
+            level.maxInterval = qMax(1, atoi(value));
+            ++i;
+        } else if (strcmp(arg, "--song") == 0) {
+            songLength = qMax(1, atoi(value));
+            ++i;
+        } else if (strcmp(arg, "--max-steps") == 0) {
+            maxSteps = qMax<quint64>(1, strtoull(value, nullptr, 10));
+            ++i;
+        } else if (strcmp(arg, "--fuzz") == 0) {
+            fuzz = true;
+        } else if (strcmp(arg, "--verify") == 0) {
+            verify = true;
+        } else if (strcmp(arg, "--expect-hash") == 0) {
+            expectHash = true;
+            expectedRunHash = quint32(strtoul(value, nullptr, 16));
+            ++i;
+        } else {
+            fprintf(stderr, "Usage: %s [--ticks N] [--seed S] [--input random|sine|chase|idle|script:FILE]\n"
+                            "          [--size WxH] [--level MODE] [--interval N] [--difficulty P]\n"
+                            "          [--song N] [--max-steps N] [--fuzz] [--verify] [--expect-hash H]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (ticks == 0) ticks = 1000000;
+    lcgState = seed;
+
+    static GameSimulation sim;         // 엔티티 배열이 커서 정적 저장소에 둠
+    static GameSimulation replay;
+    level.width = width;
+    level.height = height;
+    level.seed = seed;
+
+    if (songLength > 0) {
+        // 미리 계산한 피치 트랙 (음 모드가 아니면 음이 0)
+        sim.reset(level);
+        const QVector<SongNote> track = sim.pitchTrack(songLength);
+        printf("Level %s, seed %u, world %dx%d\n", level.levelMode == LevelGenerator::Melody
+               ? LevelGenerator::melodyName(level.melody) : level.levelMode == LevelGenerator::ScaleWalk ? "scale" : "random",
+               seed, width, height);
+        for (int i = 0; i < track.size(); ++i)
+            printf("%4d  step %6d (%7.2f s)  note %2d\n", i, track[i].step, track[i].step / double(GameSimulation::STEP_HZ), track[i].note);
+        return 0;
+    }
+
+    // 게임마다 점수/길이 기록 (게임 수 상한을 넉넉히 잡아 측정 중 재할당 없음)
+    QVector<int> scores;
+    QVector<int> lengths;
+    scores.reserve(int(qMin<quint64>(ticks / 100 + 16, 1 << 24)));
+    lengths.reserve(scores.capacity());
+
+    Violations violations;
+    int hashMismatches = 0;
+    quint32 runHash = 2166136261u;     // 게임별 마지막 stateHash를 순서대로 합침 (FNV-1a)
+    qint64 accuracySum = 0;
+    int accuracyGames = 0;
+    quint64 stepAllocations = 0;
+    quint64 done = 0;
+    qint64 simNs = 0;
+    int game = 0;
+    QElapsedTimer timer;
+
+    printf("Ticks: %llu, seed %u, input %s%s%s, world %dx%d, difficulty %s\n", (unsigned long long)ticks, seed,
+           fuzz ? "fuzzed" : modeName(mode), fuzz ? " (random size/input/level per game)" : "",
+           verify ? ", verifying determinism" : "", width, height,
+           level.difficulty ? level.difficulty->name : DifficultyEngine::defaultProfile().name);
+
+    // 퍼징 전용: 스텝당 이동이 장애물+플레이어 너비(70)를 넘는 프로파일 (스윕 없이는 통과해 버림)
+    static const DifficultyEngine::Profile extreme = {
+        "fuzz-extreme", 20 * DifficultyEngine::SPEED_ONE, 90 * DifficultyEngine::SPEED_ONE, 120, 60, 200, 120, 50, 60
+    };
+
+    while (done < ticks) {
+        GameSimulation::Config config = level;
+        config.seed = seed + quint32(game);
+        if (fuzz) {
+            // 작은 보드부터 세로 화면까지
+            config.width = 320 + nextRandom(1600);
+            config.height = 240 + nextRandom(1200);
+            mode = script.isEmpty() ? InputMode(nextRandom(InputScript)) : InputMode(nextRandom(InputScript + 1));
+            config.levelMode = LevelGenerator::Mode(nextRandom(3));
+            config.scale = LevelGenerator::Scale(nextRandom(4));
+            config.maxInterval = 1 + nextRandom(4);
+            config.melody = nextRandom(LevelGenerator::melodyCount());
+            const int profile = nextRandom(DifficultyEngine::profileCount() + 1);
+            config.difficulty = profile < DifficultyEngine::profileCount() ? &DifficultyEngine::profileAt(profile) : &extreme;
+        }
+        InputSource gameInput(mode, script);
+        gameInput.restart();
+        const quint32 inputSeed = lcgState;
+        sim.reset(config);
+
+        int previousGapCenter = -1;     // 첫 쌍은 이웃 검사 없음
+        int previousGapSize = 0;
+        int previousScore = 0;
+        timer.start();
+        while (!sim.isOver() && sim.stepCount() < maxSteps && done < ticks) {
+            const SimInput in = gameInput.next(sim);
+            const int previousY = sim.player().y();
+            const quint64 allocationsBefore = AllocationCounter::count();
+            const SimEvents events = sim.step(in);
+            stepAllocations += AllocationCounter::count() - allocationsBefore;
+            ++done;
+
+            checkStep(sim, previousScore, game, violations);
+            if (!events.collided)
+                checkTunnelling(sim, previousY, game, violations);
+            previousScore = sim.score();
+            if (events.spawned)
+                checkSpawn(sim, previousGapCenter, previousGapSize, game, violations);
+        }
+        simNs += timer.nsecsElapsed();
+
+        if (verify) {
+            // 같은 설정/같은 입력 순서로 다시 실행해 마지막 상태가 같은지 확인
+            const quint32 afterSeed = lcgState;
+            lcgState = inputSeed;
+            InputSource replayInput(mode, script);
+            replayInput.restart();
+            replay.reset(config);
+            while (replay.stepCount() < sim.stepCount() && !replay.isOver())
+                replay.step(replayInput.next(replay));
+            if (replay.stateHash() != sim.stateHash()) {
+                ++hashMismatches;
+                violations.report(game, sim.stepCount(), sim, "replay diverged (stateHash mismatch)");
+            }
+            lcgState = afterSeed;
+        }
+
+        for (int shift = 0; shift < 32; shift += 8)
+            runHash = (runHash ^ ((sim.stateHash() >> shift) & 0xFF)) * 16777619u;
+
+        if (sim.isOver()) {
+            scores.append(sim.score());
+            lengths.append(int(sim.stepCount()));
+        }
+        if (sim.pitchAccuracy() >= 0) {
+            accuracySum += sim.pitchAccuracy();
+            ++accuracyGames;
+        }
+        ++game;
+    }
+
+    const double seconds = simNs / 1e9;
+    printf("Games: %d (%d ended by collision), %.2f s simulated in %.3f s\n", game, scores.size(),
+           done / double(GameSimulation::STEP_HZ), seconds);
+    printf("Throughput: %.0f ticks/s (%.1f ns/tick, %.0fx real time, incl. invariant checks)\n",
+           seconds > 0 ? done / seconds : 0.0, seconds > 0 ? simNs / double(done) : 0.0,
+           seconds > 0 ? done / double(GameSimulation::STEP_HZ) / seconds : 0.0);
+    printf("Allocations during steps: %llu (%.3f per 1000 ticks)\n",
+           (unsigned long long)stepAllocations, stepAllocations * 1000.0 / done);
+
+    if (!scores.isEmpty()) {
+        QVector<int> sorted = scores;
+        std::sort(sorted.begin(), sorted.end());
+        const int n = sorted.size();
+        qint64 total = 0;
+        for (int s : sorted) total += s;
+        printf("Score: min %d, median %d, p90 %d, p99 %d, max %d, mean %.1f\n",
+               sorted[0], sorted[n / 2], sorted[int(n * 0.9)], sorted[int(n * 0.99)], sorted[n - 1], double(total) / n);
+
+        // 점수 구간별 게임 수 (2배씩 늘어나는 구간)
+        printf("Score histogram:");
+        int bucketStart = 0;
+        int bucketEnd = 1;
+        int index = 0;
+        while (index < n) {
+            int count = 0;
+            while (index < n && sorted[index] < bucketEnd) {
+                ++count;
+                ++index;
+            }
+            if (count)
+                printf(" [%d-%d) %d", bucketStart, bucketEnd, count);
+            bucketStart = bucketEnd;
+            bucketEnd *= 2;
+        }
+        printf("\n");
+
+        QVector<int> sortedLengths = lengths;
+        std::sort(sortedLengths.begin(), sortedLengths.end());
+        printf("Game length: median %.1f s, max %.1f s\n",
+               sortedLengths[n / 2] / double(GameSimulation::STEP_HZ), sortedLengths[n - 1] / double(GameSimulation::STEP_HZ));
+    }
+
+    if (accuracyGames)
+        printf("Pitch accuracy: %.1f%% of steps inside note gaps (mean of %d games, +-%d semitone)\n",
+               double(accuracySum) / accuracyGames, accuracyGames, GameSimulation::PITCH_TOLERANCE);
+    if (verify)
+        printf("Determinism: %d/%d games replayed identically\n", game - hashMismatches, game);
+    printf("Invariant violations: %d\n", violations.count);
+    for (int i = 0; i < violations.kinds; ++i)
+        printf("  %6d  %s\n", violations.kindCount[i], violations.kindName[i]);
+    printf("Run hash: %08x", runHash);
+    if (expectHash)
+        printf(" (%s %08x)", runHash == expectedRunHash ? "matches" : "MISMATCH, expected", expectedRunHash);
+    printf("\n");
+    return violations.count || (expectHash && runHash != expectedRunHash) ? 1 : 0;
+}
@@ -0,0 +1,30 @@
+#-------------------------------------------------
+#
+# 헤드리스 시뮬레이션 실행기 (창/마이크 없이 GameSimulation만 구동, 사용법은 simrunner.cpp 머리말)
+# 빌드: qmake simrunner.pro && make
+#
+#-------------------------------------------------
+
+QT       = core
+
+TARGET = simrunner
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+# 스텝 중 힙 할당 횟수 출력용 (빌드 종류와 무관하게 항상 켬)
+DEFINES += ALLOCATION_COUNTER
+
+SOURCES += simrunner.cpp\
+        allocationcounter.cpp\
+        gamesimulation.cpp\
+        levelgenerator.cpp\
+        difficultyengine.cpp\
+        entitystore.cpp
+
+HEADERS  += allocationcounter.h\
+        gamesimulation.h\
+        levelgenerator.h\
+        difficultyengine.h\
+        entitystore.h\
+        ringbuffer.h
@@ -0,0 +1,69 @@
+#include "snapshotbuffer.h"
+
+SnapshotBuffer::SnapshotBuffer()
+    : head(0)
+    , count(0)
+    , clockOffset(0)
+{
+}
+
+void SnapshotBuffer::clear()
+{
+    head = 0;
+    count = 0;
+}
+
+void SnapshotBuffer::push(qint64 senderTime, const QPointF &pos, qint64 localTime)
+{
+    if (count > 0 && senderTime <= at(count - 1).time)
+        return;
+
+    const qint64 offset = localTime - senderTime;
+    if (count == 0)
+        clockOffset = offset;
+    else
+        clockOffset = qMin(clockOffset + OFFSET_DRIFT_MS, offset);
+
+    ring[head].time = senderTime;
+    ring[head].pos = pos;
+    head = (head + 1) % CAPACITY;
+    if (count < CAPACITY)
+        ++count;
+}
+
+QPointF SnapshotBuffer::sample(qint64 localTime, int delayMs, bool *extrapolated) const
+{
+    if (extrapolated)
+        *extrapolated = false;
+    if (count == 0)
+        return QPointF();
+
+    // 보낸 쪽 시계 기준 그릴 시각
+    const qint64 target = localTime - clockOffset - delayMs;
+    if (target <= at(0).time)
+        return at(0).pos;
+
+    const Snapshot &newest = at(count - 1);
+    if (target >= newest.time) {
+        if (count < 2)
+            return newest.pos;
+        // 마지막 두 스냅샷의 속도로 추정
+        const Snapshot &prev = at(count - 2);
+        const qint64 ahead = qMin<qint64>(target - newest.time, MAX_EXTRAPOLATION_MS);
+        if (extrapolated)
+            *extrapolated = ahead > 0;
+        const qreal t = qreal(ahead) / qreal(newest.time - prev.time);
+        return newest.pos + (newest.pos - prev.pos) * t;
+    }
+
+    // 뒤에서부터 target을 감싸는 구간 검색 (보통 마지막 한두 구간)
+    for (int i = count - 1; i > 0; --i) {
+        const Snapshot &a = at(i - 1);
+        if (a.time <= target) {
+            const Snapshot &b = at(i);
+            const qreal t = qreal(target - a.time) / qreal(b.time - a.time);
+            return a.pos + (b.pos - a.pos) * t;
+        }
+    }
+    return at(0).pos;
+}
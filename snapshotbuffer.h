@@ -0,0 +1,42 @@
+#ifndef SNAPSHOTBUFFER_H
+#define SNAPSHOTBUFFER_H
+
+#include <QPointF>
+#include <QtGlobal>
+
+// 원격 플레이어 위치 스냅샷 버퍼 (보낸 쪽 타임스탬프 기준)
+// 수신 시각과 보낸 시각의 차이 중 최소값으로 상대 시계를 추정하고
+// 그리기 시각에서 고정 지연만큼 과거의 위치를 두 스냅샷 사이 보간으로 구함
+// 패킷이 끊겨 최신 스냅샷보다 나중 시각이 필요하면 마지막 속도로 잠시 추정(dead reckoning)한 뒤 멈춤
+class SnapshotBuffer
+{
+public:
+    SnapshotBuffer();
+
+    // senderTime: 보낸 쪽 시각(ms), localTime: 받은 시각(ms, 단조 증가)
+    // 순서가 뒤바뀌었거나 중복된 패킷은 버림
+    void push(qint64 senderTime, const QPointF &pos, qint64 localTime);
+    void clear();
+    bool isEmpty() const { return count == 0; }
+
+    // localTime - delayMs 시점의 위치 (extrapolated: 최신 스냅샷 이후를 추정했는지)
+    QPointF sample(qint64 localTime, int delayMs, bool *extrapolated = nullptr) const;
+
+private:
+    struct Snapshot {
+        qint64 time;
+        QPointF pos;
+    };
+    static const int CAPACITY = 16;              // 100ms 간격이면 1.6초 분량
+    static const int MAX_EXTRAPOLATION_MS = 250; // 이보다 오래 끊기면 마지막 추정 위치에서 멈춤
+    static const int OFFSET_DRIFT_MS = 1;        // 패킷마다 시계 차 추정치를 조금씩 늘려 시계 오차/경로 변화 따라감
+
+    const Snapshot &at(int i) const { return ring[(head + CAPACITY - count + i) % CAPACITY]; }
+
+    Snapshot ring[CAPACITY];
+    int head;        // 다음에 쓸 위치
+    int count;
+    qint64 clockOffset;  // 받은 시각 - 보낸 시각의 최소값 추정 (상대 시계 차 + 최소 지연)
+};
+
+#endif // SNAPSHOTBUFFER_H
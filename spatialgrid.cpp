@@ -0,0 +1,78 @@
+#include "spatialgrid.h"
+
+SpatialGrid::SpatialGrid(const QRect &bounds, int cellSize, int maxEntities, const QSize &maxEntitySize)
+    : bounds(bounds)
+    , cellSize(qMax(1, cellSize))
+    , columnCount(qMax(1, (bounds.width() + this->cellSize - 1) / this->cellSize))
+    , rowCount(qMax(1, (bounds.height() + this->cellSize - 1) / this->cellSize))
+    , queryStamp(0)
+{
+    cellHead.fill(-1, columnCount * rowCount);
+    nodes.reserve(maxEntities * maxCellSpan(maxEntitySize));
+    seen.fill(0, maxEntities);
+}
+
+int SpatialGrid::maxCellSpan(const QSize &size) const
+{
+    // 칸 경계에 어긋나면 한 축에 (크기 - 1) / 칸 + 2칸까지 걸침 (격자 밖은 가장자리 칸으로 모임)
+    const int columns = qMin(columnCount, (qMax(1, size.width()) - 1) / cellSize + 2);
+    const int rows = qMin(rowCount, (qMax(1, size.height()) - 1) / cellSize + 2);
+    return columns * rows;
+}
+
+void SpatialGrid::clear()
+{
+    cellHead.fill(-1);
+    nodes.resize(0);
+}
+
+void SpatialGrid::cellRange(const QRect &rect, int &c0, int &r0, int &c1, int &r1) const
+{
+    c0 = qBound(0, (rect.x() - bounds.x()) / cellSize, columnCount - 1);
+    r0 = qBound(0, (rect.y() - bounds.y()) / cellSize, rowCount - 1);
+    c1 = qBound(0, (rect.x() + rect.width() - 1 - bounds.x()) / cellSize, columnCount - 1);
+    r1 = qBound(0, (rect.y() + rect.height() - 1 - bounds.y()) / cellSize, rowCount - 1);
+}
+
+void SpatialGrid::insert(int id, const QRect &rect)
+{
+    Q_ASSERT(id >= 0 && id < seen.size());
+    if (rect.width() <= 0 || rect.height() <= 0) return;
+    int c0, r0, c1, r1;
+    cellRange(rect, c0, r0, c1, r1);
+    for (int r = r0; r <= r1; ++r) {
+        for (int c = c0; c <= c1; ++c) {
+            int &head = cellHead[r * columnCount + c];
+            Node node;
+            node.id = id;
+            node.next = head;
+            head = nodes.size();
+            nodes.append(node);
+        }
+    }
+}
+
+int SpatialGrid::query(const QRect &box, int *out, int maxOut) const
+{
+    if (box.width() <= 0 || box.height() <= 0) return 0;
+    if (++queryStamp == 0) {
+        // 질의 번호가 한 바퀴 돌면 표시 초기화
+        seen.fill(0);
+        queryStamp = 1;
+    }
+    int c0, r0, c1, r1;
+    cellRange(box, c0, r0, c1, r1);
+    int found = 0;
+    for (int r = r0; r <= r1; ++r) {
+        for (int c = c0; c <= c1; ++c) {
+            for (int n = cellHead[r * columnCount + c]; n >= 0; n = nodes[n].next) {
+                const int id = nodes[n].id;
+                if (seen[id] == queryStamp) continue;
+                seen[id] = queryStamp;
+                if (found == maxOut) return found;
+                out[found++] = id;
+            }
+        }
+    }
+    return found;
+}
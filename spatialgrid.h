@@ -0,0 +1,47 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <QRect>
+#include <QVector>
+
+// 균일 격자 광역 단계 충돌 검사
+// 속도가 제각각이라 x 순서가 보장되지 않는 많은 엔티티용 (x 순서가 보장되면 EntityStore::overlaps가 더 빠름)
+// 매 스텝 clear() 후 insert()로 다시 채우고 query()로 같은 칸의 후보만 꺼내 정밀 검사함
+// 지금 게임의 엔티티는 모두 같은 속도라 쓰지 않음 (앱 빌드에서 제외, entitybench의 광역 단계 비교용)
+// 노드/중복 표시 배열은 생성 시 최악의 경우(모든 엔티티가 maxEntitySize 크기)로 잡아 재사용하므로
+// 그보다 큰 엔티티를 넣지 않는 한 플레이 중 할당이 없음 (넘으면 노드 배열이 늘어날 뿐 결과는 같음)
+class SpatialGrid
+{
+public:
+    SpatialGrid(const QRect &bounds, int cellSize, int maxEntities, const QSize &maxEntitySize);
+
+    void clear();
+    // id는 0 이상 maxEntities 미만, bounds 밖은 가장자리 칸에 넣음
+    void insert(int id, const QRect &rect);
+    // box와 칸이 겹치는 후보 id를 중복 없이 최대 maxOut개 기록, 개수 반환
+    int query(const QRect &box, int *out, int maxOut) const;
+
+    int columns() const { return columnCount; }
+    int rows() const { return rowCount; }
+    // 이 크기의 엔티티 하나가 걸칠 수 있는 최대 칸 수 (칸 경계에 어긋나게 놓인 경우 포함)
+    int maxCellSpan(const QSize &size) const;
+
+private:
+    struct Node {
+        int id;
+        int next;   // 같은 칸의 다음 노드 (-1이면 끝)
+    };
+
+    void cellRange(const QRect &rect, int &c0, int &r0, int &c1, int &r1) const;
+
+    QRect bounds;
+    int cellSize;
+    int columnCount;
+    int rowCount;
+    QVector<int> cellHead;      // 칸마다 첫 노드 (-1이면 빈 칸)
+    QVector<Node> nodes;
+    mutable QVector<quint32> seen;  // id별 마지막 질의 번호 (중복 제거)
+    mutable quint32 queryStamp;
+};
+
+#endif // SPATIALGRID_H
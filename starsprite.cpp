@@ -0,0 +1,88 @@
+#include "starsprite.h"
+#include <QPen>
+#include <QtMath>
+#include <QDebug>
+
+StarSprite::StarSprite()
+    : starSize(0)
+    , dpr(1.0)
+    , frames(0)
+    , cellSize(0)
+    , cellPixels(0)
+{
+}
+
+QPainterPath StarSprite::buildStarPath() const
+{
+    QPainterPath path;
+    const qreal angleStep = M_PI / STAR_POINTS;
+    for (int i = 0; i < STAR_POINTS * 2; ++i) {
+        const qreal radius = (i % 2 == 0) ? starSize * OUTER_RADIUS / 2 : starSize * INNER_RADIUS / 2;
+        const QPointF point(radius * qSin(i * angleStep), -radius * qCos(i * angleStep));
+        if (i == 0) path.moveTo(point);
+        else path.lineTo(point);
+    }
+    path.closeSubpath();
+    return path;
+}
+
+// 원점에 별 하나를 그림 (기존 paintEvent의 별 + 얼굴 그리기와 동일한 모양)
+void StarSprite::renderFrame(QPainter &painter, const QPainterPath &starPath, const QPainterPath &smilePath, qreal angle) const
+{
+    painter.save();
+    painter.rotate(angle);
+
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(255, 223, 0));  // 밝은 노란색
+    painter.drawPath(starPath);
+
+    // 얼굴: 눈과 미소
+    painter.setPen(QPen(Qt::black, 2));
+    painter.setBrush(Qt::black);
+    painter.drawEllipse(QPointF(-starSize / 8, -starSize / 8), 2.5, 2.5);
+    painter.drawEllipse(QPointF(starSize / 8, -starSize / 8), 2.5, 2.5);
+    painter.setBrush(Qt::NoBrush);
+    painter.drawPath(smilePath);
+
+    painter.restore();
+}
+
+bool StarSprite::prepare(int size, qreal devicePixelRatio, int frameCount)
+{
+    frameCount = qMax(1, frameCount);
+    if (!atlas.isNull() && size == starSize && qFuzzyCompare(devicePixelRatio, dpr) && frameCount == frames)
+        return false;
+
+    starSize = size;
+    dpr = devicePixelRatio;
+    frames = frameCount;
+    cellSize = starSize + CELL_PADDING * 2;
+    cellPixels = qCeil(cellSize * dpr);
+
+    atlas = QPixmap(cellPixels * frames, cellPixels);
+    atlas.setDevicePixelRatio(dpr);
+    atlas.fill(Qt::transparent);
+
+    const QPainterPath starPath = buildStarPath();
+    QPainterPath smilePath;
+    const qreal smileWidth = starSize / 5;
+    const qreal smileHeight = starSize / 8;
+    smilePath.moveTo(-smileWidth, 0);
+    smilePath.quadTo(0, smileHeight, smileWidth, 0);
+
+    // 한 번만 그리므로 안티앨리어싱을 켜서 품질을 높임
+    QPainter painter(&atlas);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    const qreal cellLogical = cellPixels / dpr;
+    for (int f = 0; f < frames; ++f) {
+        const qreal angle = frames > 1 ? WOBBLE_DEGREES * qSin(2 * M_PI * f / frames) : 0.0;
+        painter.save();
+        painter.translate(cellLogical * f + cellLogical / 2, cellLogical / 2);
+        renderFrame(painter, starPath, smilePath, angle);
+        painter.restore();
+    }
+    painter.end();
+
+    qDebug() << "StarSprite: atlas" << atlas.width() << "x" << atlas.height() << "frames" << frames << "dpr" << dpr;
+    return true;
+}
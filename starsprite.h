@@ -0,0 +1,45 @@
+#ifndef STARSPRITE_H
+#define STARSPRITE_H
+
+#include <QPixmap>
+#include <QPointF>
+#include <QPainter>
+#include <QPainterPath>
+
+// 얼굴이 있는 별을 한 번만 그려 두는 스프라이트 아틀라스
+// 프레임마다 경로 테셀레이션/펜 전환 없이 drawPixmap 한 번으로 별을 그림
+// 아틀라스는 가로로 나열된 셀이며, 셀마다 조금씩 기울어진 흔들림 애니메이션 프레임이 들어감
+class StarSprite
+{
+public:
+    StarSprite();
+
+    // 크기/배율/프레임 수가 바뀐 경우에만 다시 그림 (다시 그렸으면 true)
+    bool prepare(int starSize, qreal devicePixelRatio, int frames);
+
+    // 셀 배치는 GameScene::addStar가 담당 (셀 크기 = 아틀라스 높이)
+    const QPixmap &pixmap() const { return atlas; }
+
+    int frameCount() const { return frames; }
+    bool isNull() const { return atlas.isNull(); }
+
+private:
+    QPainterPath buildStarPath() const;
+    void renderFrame(QPainter &painter, const QPainterPath &starPath, const QPainterPath &smilePath, qreal angle) const;
+
+    // 별 모양 상수
+    static constexpr int STAR_POINTS = 5;         // 별의 꼭지점 수
+    static constexpr float OUTER_RADIUS = 1.0f;   // 외부 반지름 비율
+    static constexpr float INNER_RADIUS = 0.38f;  // 내부 반지름 비율 (더 뾰족하게)
+    static constexpr qreal WOBBLE_DEGREES = 12.0; // 애니메이션 최대 기울기
+    static const int CELL_PADDING = 2;            // 외곽선이 잘리지 않도록 여백
+
+    QPixmap atlas;
+    int starSize;
+    qreal dpr;
+    int frames;
+    int cellSize;   // 논리 좌표 기준 셀 크기
+    int cellPixels; // 실제 픽셀 기준 셀 크기
+};
+
+#endif // STARSPRITE_H
@@ -2,97 +2,183 @@
 #include <stdlib.h>
 #include <alsa/asoundlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
-#include <unistd.h>
+#include <time.h>
+#include "wavetable.h"
 
-#define SAMPLE_RATE 16000
-#define FRAME_SIZE 1024
-#define MIN_PITCH_HZ 80
-#define MAX_PITCH_HZ 1000
+// 기준음 생성기 (게임 오디오 엔진과 같은 웨이브테이블 오실레이터 사용)
+// 빌드: gcc -O2 tone.c wavetable.c -o tone -lasound -lm
+// 사용법:
+//   ./tone <score|Hz> [seconds]   기준음 재생 (1~37은 피치 점수 F#2~F#5, 그 이상은 Hz)
+//   ./tone --bench [periods]      오실레이터 + 믹서 처리 시간이 주기 예산 안에 드는지 측정
 
-double detect_pitch_int(short *buffer, int size, int sample_rate) {
-    int min_lag = sample_rate / MAX_PITCH_HZ;
-    int max_lag = sample_rate / MIN_PITCH_HZ;
+#define SAMPLE_RATE 44100
+#define PERIOD_FRAMES 512
+#define MIX_VOICES 8          // 오디오 엔진 MAX_VOICES와 동일
+#define TONE_GAIN 13107       // Q16, 약 0.2 (-14dB)
+#define FADE_FRAMES 441       // 10ms
 
-    int best_lag = -1;
-    int64_t max_corr = 0;
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
 
-    for (int lag = min_lag; lag <= max_lag; lag++) {
-        int64_t corr = 0;
-        for (int i = 0; i < size - lag; i++) {
-            corr += (int32_t)buffer[i] * (int32_t)buffer[i + lag];
-        }
-        if (corr > max_corr) {
-            max_corr = corr;
-            best_lag = lag;
-        }
+static void mix_to_output(const int32_t *acc, short *out, int frames) {
+    for (int i = 0; i < frames * 2; ++i) {
+        int32_t v = acc[i];
+        if (v > 32767) v = 32767;
+        if (v < -32768) v = -32768;
+        out[i] = (short)v;
     }
+}
+
+static int compare_i64(const void *a, const void *b) {
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// 엔진 한 주기와 같은 작업량(보이스 누산 + 오실레이터 + 클리핑)을 반복 측정
+static int run_bench(int periods) {
+    static int32_t acc[PERIOD_FRAMES * 2];
+    static short voices[MIX_VOICES][PERIOD_FRAMES * 2];
+    static short out[PERIOD_FRAMES * 2];
+    wt_osc_t osc;
+
+    for (int v = 0; v < MIX_VOICES; ++v)
+        for (int i = 0; i < PERIOD_FRAMES * 2; ++i)
+            voices[v][i] = (short)((rand() % 8192) - 4096);
+
+    wt_osc_init(&osc, SAMPLE_RATE);
+    wt_osc_set_gain(&osc, TONE_GAIN, FADE_FRAMES);
 
-    if (best_lag > 0) {
-        return (double)sample_rate / best_lag;
-    } else {
-        return 0.0;
+    int64_t *samples = malloc(sizeof(int64_t) * periods);
+    if (!samples) return 1;
+    const double budget_us = PERIOD_FRAMES * 1000000.0 / SAMPLE_RATE;
+    int64_t osc_total = 0, osc_max = 0, total = 0, total_max = 0;
+    for (int p = 0; p < periods; ++p) {
+        // 매 주기 음을 바꿔 주파수 변경 경로도 포함
+        wt_osc_set_freq(&osc, wt_score_to_hz(1 + p % 37), SAMPLE_RATE);
+
+        int64_t t0 = now_ns();
+        memset(acc, 0, sizeof(acc));
+        for (int v = 0; v < MIX_VOICES; ++v)
+            for (int i = 0; i < PERIOD_FRAMES * 2; ++i)
+                acc[i] += voices[v][i];
+        int64_t t1 = now_ns();
+        wt_osc_render_add(&osc, acc, PERIOD_FRAMES);
+        int64_t t2 = now_ns();
+        mix_to_output(acc, out, PERIOD_FRAMES);
+        int64_t t3 = now_ns();
+
+        int64_t osc_ns = t2 - t1;
+        int64_t all_ns = t3 - t0;
+        osc_total += osc_ns;
+        total += all_ns;
+        if (osc_ns > osc_max) osc_max = osc_ns;
+        if (all_ns > total_max) total_max = all_ns;
+        samples[p] = all_ns;
     }
+
+    // 선점(스케줄링) 잡음을 제외하기 위해 판정은 99 백분위수 기준
+    qsort(samples, periods, sizeof(int64_t), compare_i64);
+    double p99_us = samples[(int)(periods * 0.99)] / 1000.0;
+    free(samples);
+
+    printf("Period: %d frames @ %d Hz (budget %.0f us)\n", PERIOD_FRAMES, SAMPLE_RATE, budget_us);
+    printf("Oscillator: avg %.2f us, max %.2f us (%.3f%% of budget)\n",
+           osc_total / 1000.0 / periods, osc_max / 1000.0, osc_total / 10.0 / periods / budget_us);
+    printf("Mixer (%d voices + tone): avg %.2f us, p99 %.2f us, max %.2f us (%.3f%% of budget)\n",
+           MIX_VOICES, total / 1000.0 / periods, p99_us, total_max / 1000.0, total / 10.0 / periods / budget_us);
+    printf("Result: %s\n", p99_us < budget_us * 0.25 ? "WITHIN BUDGET" : "OVER 25% OF BUDGET");
+    (void)out;
+    return 0;
 }
 
-int main() {
-    const char *device = "plughw:4,0"; // 마이크 장치
+static int play_tone(double hz, double seconds) {
+    const char *device = "plughw:0,0"; // 스피커 장치
     snd_pcm_t *pcm_handle;
     snd_pcm_hw_params_t *params;
     int pcm;
 
-    short buffer[FRAME_SIZE];
-
-    // ALSA PCM 캡처 장치 열기
-    if ((pcm = snd_pcm_open(&pcm_handle, device, SND_PCM_STREAM_CAPTURE, 0)) < 0) {
+    if ((pcm = snd_pcm_open(&pcm_handle, device, SND_PCM_STREAM_PLAYBACK, 0)) < 0) {
         fprintf(stderr, "ERROR: Cannot open PCM device %s: %s\n", device, snd_strerror(pcm));
         return 1;
     }
 
-    // 하드웨어 파라미터 구조체 초기화
     snd_pcm_hw_params_alloca(&params);
     snd_pcm_hw_params_any(pcm_handle, params);
     snd_pcm_hw_params_set_access(pcm_handle, params, SND_PCM_ACCESS_RW_INTERLEAVED);
     snd_pcm_hw_params_set_format(pcm_handle, params, SND_PCM_FORMAT_S16_LE);
-    snd_pcm_hw_params_set_channels(pcm_handle, params, 1); // 모노
+    snd_pcm_hw_params_set_channels(pcm_handle, params, 2);
     snd_pcm_hw_params_set_rate(pcm_handle, params, SAMPLE_RATE, 0);
-    snd_pcm_hw_params_set_period_size(pcm_handle, params, FRAME_SIZE, 0);
+    snd_pcm_hw_params_set_period_size(pcm_handle, params, PERIOD_FRAMES, 0);
 
-    // 파라미터 설정 적용
     if ((pcm = snd_pcm_hw_params(pcm_handle, params)) < 0) {
         fprintf(stderr, "ERROR: Can't set hardware parameters: %s\n", snd_strerror(pcm));
+        snd_pcm_close(pcm_handle);
         return 1;
     }
 
-    printf("🎙️ Listening for pitch (press Ctrl+C to stop)...\n");
+    printf("🎵 Reference tone: %.2f Hz for %.1f s\n", hz, seconds);
 
-    while (1) {
-        pcm = snd_pcm_readi(pcm_handle, buffer, FRAME_SIZE);
+    static int32_t acc[PERIOD_FRAMES * 2];
+    static short out[PERIOD_FRAMES * 2];
+    wt_osc_t osc;
+    wt_osc_init(&osc, SAMPLE_RATE);
+    wt_osc_set_freq(&osc, hz, SAMPLE_RATE);
+    wt_osc_set_gain(&osc, TONE_GAIN, FADE_FRAMES);
+
+    long total = (long)(seconds * SAMPLE_RATE);
+    long played = 0;
+    int fading = 0;
+    while (played < total + FADE_FRAMES) {
+        if (!fading && played >= total) {
+            wt_osc_set_gain(&osc, 0, FADE_FRAMES);
+            fading = 1;
+        }
+        memset(acc, 0, sizeof(acc));
+        wt_osc_render_add(&osc, acc, PERIOD_FRAMES);
+        mix_to_output(acc, out, PERIOD_FRAMES);
+
+        pcm = snd_pcm_writei(pcm_handle, out, PERIOD_FRAMES);
         if (pcm == -EPIPE) {
-            // 버퍼 오버런
-            fprintf(stderr, "XRUN (overrun)\n");
+            // 버퍼 언더런
+            fprintf(stderr, "XRUN (underrun)\n");
             snd_pcm_prepare(pcm_handle);
             continue;
         } else if (pcm < 0) {
-            fprintf(stderr, "ERROR reading from PCM device: %s\n", snd_strerror(pcm));
-            continue;
-        } else if (pcm != FRAME_SIZE) {
-            fprintf(stderr, "Short read: got %d frames\n", pcm);
-            continue;
-        }
-
-        // 피치 계산
-        double pitch = detect_pitch_int(buffer, FRAME_SIZE, SAMPLE_RATE);
-        if (pitch >= MIN_PITCH_HZ && pitch <= MAX_PITCH_HZ) {
-            printf("🎵 Pitch: %.2f Hz\n", pitch);
-        } else {
-            printf("... (No valid pitch)\n");
+            fprintf(stderr, "ERROR writing to PCM device: %s\n", snd_strerror(pcm));
+            break;
         }
-
-        // CPU 사용량 줄이기 위해 약간 쉬기
-        usleep(20000); // 20ms
+        played += pcm;
     }
 
+    snd_pcm_drain(pcm_handle);
     snd_pcm_close(pcm_handle);
     return 0;
 }
+
+int main(int argc, char **argv) {
+    wt_init_table();
+
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0) {
+        int periods = argc >= 3 ? atoi(argv[2]) : 10000;
+        return run_bench(periods > 0 ? periods : 10000);
+    }
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <score 1-37 | Hz> [seconds]\n       %s --bench [periods]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    double value = atof(argv[1]);
+    double hz = (value >= 1 && value <= 37) ? wt_score_to_hz((int)value) : value;
+    double seconds = argc >= 3 ? atof(argv[2]) : 2.0;
+    if (hz <= 0.0 || seconds <= 0.0) {
+        fprintf(stderr, "Invalid tone parameters\n");
+        return 1;
+    }
+    return play_tone(hz, seconds);
+}
@@ -0,0 +1,84 @@
+#include "wavetable.h"
+#include <math.h>
+
+/* 마지막에 첫 샘플을 한 번 더 두어 보간 시 경계 검사를 생략 */
+static int16_t wt_table[WT_TABLE_SIZE + 1];
+
+void wt_init_table(void) {
+    /* 기본음 + 약한 배음: 순수 사인보다 따라 부르기 쉬우면서 피치 검출기는 기본음을 잡음 */
+    for (int i = 0; i <= WT_TABLE_SIZE; ++i) {
+        double t = 2.0 * M_PI * i / WT_TABLE_SIZE;
+        double v = sin(t) + 0.3 * sin(2.0 * t) + 0.12 * sin(3.0 * t);
+        wt_table[i] = (int16_t)lrint(v / 1.3 * 32000.0);
+    }
+    wt_table[WT_TABLE_SIZE] = wt_table[0];
+}
+
+double wt_score_to_hz(int score) {
+    int midi = 42 + (score - 1); /* F#2 = MIDI 42 */
+    return 440.0 * pow(2.0, (midi - 69) / 12.0);
+}
+
+void wt_osc_init(wt_osc_t *osc, int sample_rate) {
+    osc->phase = 0;
+    osc->amplitude = 0;
+    osc->target = 0;
+    osc->ramp = 1;
+    wt_osc_set_freq(osc, 440.0, sample_rate);
+}
+
+void wt_osc_set_freq(wt_osc_t *osc, double hz, int sample_rate) {
+    /* [0, 나이퀴스트)로 제한: 범위 밖 double → uint32 변환은 정의되지 않은 동작 (음수/NaN은 무음) */
+    double cycles = sample_rate > 0 && hz > 0.0 ? hz / sample_rate * 4294967296.0 : 0.0;
+    if (cycles >= 2147483648.0)
+        cycles = 2147483647.0;
+    osc->increment = (uint32_t)cycles;
+}
+
+void wt_osc_set_gain(wt_osc_t *osc, int32_t gain_q16, int ramp_frames) {
+    int32_t diff = gain_q16 - osc->amplitude;
+    if (diff < 0) diff = -diff;
+    osc->target = gain_q16;
+    osc->ramp = ramp_frames > 0 ? diff / ramp_frames + 1 : diff + 1;
+}
+
+int wt_osc_is_silent(const wt_osc_t *osc) {
+    return osc->amplitude == 0 && osc->target == 0;
+}
+
+void wt_osc_render_add(wt_osc_t *osc, int32_t *acc, int frames) {
+    if (wt_osc_is_silent(osc)) {
+        osc->phase += osc->increment * (uint32_t)frames; /* 위상은 계속 진행 */
+        return;
+    }
+
+    uint32_t phase = osc->phase;
+    const uint32_t inc = osc->increment;
+    int32_t amp = osc->amplitude;
+    const int32_t target = osc->target;
+    const int32_t ramp = osc->ramp;
+    const int frac_shift = 32 - WT_TABLE_BITS;
+
+    for (int i = 0; i < frames; ++i) {
+        uint32_t idx = phase >> frac_shift;
+        int32_t frac = (int32_t)((phase >> (frac_shift - 15)) & 0x7FFF); /* Q15 */
+        int32_t a = wt_table[idx];
+        int32_t b = wt_table[idx + 1];
+        int32_t sample = a + (((b - a) * frac) >> 15);
+        int32_t out = (int32_t)(((int64_t)sample * amp) >> 16);
+        acc[i * 2] += out;
+        acc[i * 2 + 1] += out;
+
+        if (amp < target) {
+            amp += ramp;
+            if (amp > target) amp = target;
+        } else if (amp > target) {
+            amp -= ramp;
+            if (amp < target) amp = target;
+        }
+        phase += inc;
+    }
+
+    osc->phase = phase;
+    osc->amplitude = amp;
+}
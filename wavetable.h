@@ -0,0 +1,47 @@
+#ifndef WAVETABLE_H
+#define WAVETABLE_H
+
+/*
+ * 기준음(레퍼런스 톤) 웨이브테이블 오실레이터
+ *
+ * 32bit 위상 누산기 + 보간 테이블 조회로 샘플 단위 정확한 주파수를 내며,
+ * 렌더링 함수는 메모리 할당이나 libm 호출이 없어 오디오 스레드에서 바로 사용할 수 있다.
+ * 게임 오디오 엔진(audioengine.cpp)과 단독 실행 도구(tone.c)가 함께 사용한다.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WT_TABLE_BITS 11
+#define WT_TABLE_SIZE (1 << WT_TABLE_BITS)
+
+typedef struct {
+    uint32_t phase;       /* 현재 위상 (한 주기 = 2^32) */
+    uint32_t increment;   /* 샘플당 위상 증가량 */
+    int32_t amplitude;    /* 현재 진폭 (Q16, 65536 = 테이블 원래 크기) */
+    int32_t target;       /* 목표 진폭 - 클릭 방지를 위해 샘플마다 ramp 만큼 이동 */
+    int32_t ramp;
+} wt_osc_t;
+
+/* 테이블 생성 (프로그램 시작 시 한 번, 오디오 스레드 밖에서 호출) */
+void wt_init_table(void);
+
+/* 피치 점수(mic.c get_pitch_score, 1 = F#2 ... 37 = F#5)를 주파수로 변환 */
+double wt_score_to_hz(int score);
+
+void wt_osc_init(wt_osc_t *osc, int sample_rate);
+void wt_osc_set_freq(wt_osc_t *osc, double hz, int sample_rate);
+void wt_osc_set_gain(wt_osc_t *osc, int32_t gain_q16, int ramp_frames);
+int wt_osc_is_silent(const wt_osc_t *osc);
+
+/* frames 만큼 렌더링하여 인터리브 스테레오 누산 버퍼(int32)에 더함 */
+void wt_osc_render_add(wt_osc_t *osc, int32_t *acc, int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WAVETABLE_H */